@@ -0,0 +1,8 @@
+#pragma once
+#include <cstddef>
+
+namespace bench
+{
+    //Number of calls to the global operator new since program start.
+    std::size_t allocation_count() noexcept;
+}  // namespace bench
@@ -0,0 +1,64 @@
+#include <result/cache.hpp>
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <memory>
+#include <string>
+
+namespace
+{
+    using cache_type = xt::result_cache<std::uint64_t, std::string, std::string>;
+
+    constexpr std::uint64_t hot_key_count = 4096;
+
+    //Stands in for an expensive fallible lookup, every key divisible by 100 below the error ratio fails.
+    xt::result<std::string, std::string> resolve(std::uint64_t key, std::int64_t error_percent)
+    {
+        if (static_cast<std::int64_t>(key % 100) < error_percent)
+            return xt::error<std::string>{ "unresolvable key " + std::to_string(key) };
+
+        return std::string(64, static_cast<char>('a' + key % 26));
+    }
+
+    std::uint64_t next_random(std::uint64_t& state)
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return state;
+    }
+
+    std::unique_ptr<cache_type> g_cache{ };
+    std::atomic<std::uint64_t> g_cold_key{ hot_key_count };
+}
+
+//Arguments: hit percentage, error percentage.
+static void BM_ResultCacheMixed(benchmark::State& state)
+{
+    const std::int64_t hit_percent = state.range(0);
+    const std::int64_t error_percent = state.range(1);
+
+    if (state.thread_index() == 0)
+    {
+        g_cache = std::make_unique<cache_type>(xt::result_cache_options{ .error_ttl = std::chrono::seconds(30), .shard_count = 64, .max_entries = 1 << 18 });
+        for (std::uint64_t key = 0; key < hot_key_count; ++key)
+            g_cache->get_or_compute(key, [&](std::uint64_t k) { return resolve(k, error_percent); });
+    }
+
+    std::uint64_t random = 0x9e3779b97f4a7c15ull + static_cast<std::uint64_t>(state.thread_index());
+    for (auto _ : state)
+    {
+        const bool hit = static_cast<std::int64_t>(next_random(random) % 100) < hit_percent;
+        const std::uint64_t key = hit ? next_random(random) % hot_key_count : g_cold_key.fetch_add(1, std::memory_order_relaxed);
+        auto handle = g_cache->get_or_compute(key, [&](std::uint64_t k) { return resolve(k, error_percent); });
+        benchmark::DoNotOptimize(handle);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ResultCacheMixed)
+    ->ArgNames({ "hit%", "error%" })
+    ->Args({ 100, 0 })
+    ->Args({ 95, 5 })
+    ->Args({ 80, 10 })
+    ->Args({ 50, 25 })
+    ->ThreadRange(1, 32)
+    ->UseRealTime();
@@ -0,0 +1,70 @@
+#include <result/code.hpp>
+#include <benchmark/benchmark.h>
+#include <string>
+#include <system_error>
+
+namespace
+{
+    constexpr xt::code parse_failed = xt::make_code<"parser", "unexpected character in input">();
+
+    template <typename Err>
+    Err make_failure();
+
+    template <>
+    xt::code make_failure<xt::code>()
+    {
+        return parse_failed;
+    }
+
+    template <>
+    std::string make_failure<std::string>()
+    {
+        return "parser: unexpected character in input";
+    }
+
+    template <>
+    std::error_code make_failure<std::error_code>()
+    {
+        return std::make_error_code(std::errc::invalid_argument);
+    }
+
+    template <typename Err>
+    [[gnu::noinline]] xt::result<int, Err> parse(int input, int failure_every)
+    {
+        if (input % failure_every == 0)
+            return xt::error<Err>{ make_failure<Err>() };
+
+        return input * 2;
+    }
+
+    template <typename Err>
+    void BM_ParseWithError(benchmark::State& state)
+    {
+        const int failure_every = static_cast<int>(state.range(0));
+        int input = 1;
+        std::int64_t sum = 0;
+        for (auto _ : state)
+        {
+            const auto result = parse<Err>(input++, failure_every);
+            if (result.has_value())
+                sum += *result;
+            else
+                ++sum;
+        }
+        benchmark::DoNotOptimize(sum);
+        state.counters["sizeof_result"] = static_cast<double>(sizeof(xt::result<int, Err>));
+        state.SetItemsProcessed(state.iterations());
+    }
+}
+
+//Argument: one call in N fails.
+BENCHMARK_TEMPLATE(BM_ParseWithError, xt::code)->Arg(1)->Arg(10)->Arg(1000);
+BENCHMARK_TEMPLATE(BM_ParseWithError, std::error_code)->Arg(1)->Arg(10)->Arg(1000);
+BENCHMARK_TEMPLATE(BM_ParseWithError, std::string)->Arg(1)->Arg(10)->Arg(1000);
+
+static void BM_CodeMessageLookup(benchmark::State& state)
+{
+    for (auto _ : state)
+        benchmark::DoNotOptimize(parse_failed.message());
+}
+BENCHMARK(BM_CodeMessageLookup);
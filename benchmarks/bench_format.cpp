@@ -0,0 +1,85 @@
+#include "allocation_counter.hpp"
+#include <result/format.hpp>
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+
+namespace
+{
+    constexpr std::size_t result_count = 1'000'000;
+
+    std::vector<xt::result<int, std::string>> make_results()
+    {
+        std::vector<xt::result<int, std::string>> results{ };
+        results.reserve(result_count);
+        for (std::size_t i = 0; i < result_count; ++i)
+        {
+            if (i % 10 == 0)
+                results.emplace_back(xt::error<std::string>{ "lookup failed" });
+            else
+                results.emplace_back(static_cast<int>(i));
+        }
+        return results;
+    }
+
+    void format_results(benchmark::State& state, std::format_string<const xt::result<int, std::string>&> spec)
+    {
+        const auto results = make_results();
+        std::string buffer(result_count * 32, '\0');
+
+        std::size_t allocations = 0;
+        for (auto _ : state)
+        {
+            const auto before = bench::allocation_count();
+            char* out = buffer.data();
+            for (const auto& result : results)
+                out = std::format_to(out, spec, result);
+
+            allocations += bench::allocation_count() - before;
+            benchmark::DoNotOptimize(out);
+        }
+
+        if (allocations != 0)
+            state.SkipWithError("formatting allocated on the heap");
+
+        state.counters["allocations"] = static_cast<double>(allocations);
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * result_count));
+    }
+}
+
+static void BM_FormatResult(benchmark::State& state)
+{
+    format_results(state, "{}\n");
+}
+BENCHMARK(BM_FormatResult)->Unit(benchmark::kMillisecond);
+
+static void BM_FormatResultDebug(benchmark::State& state)
+{
+    format_results(state, "{:?}\n");
+}
+BENCHMARK(BM_FormatResultDebug)->Unit(benchmark::kMillisecond);
+
+static void BM_FormatError(benchmark::State& state)
+{
+    const xt::error<std::string> error{ "lookup failed" };
+    std::string buffer(result_count * 32, '\0');
+
+    std::size_t allocations = 0;
+    for (auto _ : state)
+    {
+        const auto before = bench::allocation_count();
+        char* out = buffer.data();
+        for (std::size_t i = 0; i < result_count; ++i)
+            out = std::format_to(out, "{}\n", error);
+
+        allocations += bench::allocation_count() - before;
+        benchmark::DoNotOptimize(out);
+    }
+
+    if (allocations != 0)
+        state.SkipWithError("formatting allocated on the heap");
+
+    state.counters["allocations"] = static_cast<double>(allocations);
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * result_count));
+}
+BENCHMARK(BM_FormatError)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,102 @@
+#include <result/interop.hpp>
+#include <benchmark/benchmark.h>
+#include <expected>
+#include <string>
+#include <vector>
+
+namespace
+{
+    constexpr std::size_t element_count = 100'000;
+
+    std::expected<std::string, std::string> make_expected(std::size_t i)
+    {
+        if (i % 10 == 0)
+            return std::unexpected<std::string>{ std::string(48, 'e') };
+
+        return std::string(48, 'v');
+    }
+
+    std::vector<std::expected<std::string, std::string>> make_expecteds()
+    {
+        std::vector<std::expected<std::string, std::string>> expecteds{ };
+        expecteds.reserve(element_count);
+        for (std::size_t i = 0; i < element_count; ++i)
+            expecteds.push_back(make_expected(i));
+
+        return expecteds;
+    }
+}
+
+//Baseline: forward a std::expected across a boundary without converting it.
+static void BM_BoundaryExpectedPassThrough(benchmark::State& state)
+{
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        std::expected<std::string, std::string> expected = make_expected(i++);
+        std::expected<std::string, std::string> forwarded{ std::move(expected) };
+        benchmark::DoNotOptimize(forwarded);
+    }
+}
+BENCHMARK(BM_BoundaryExpectedPassThrough);
+
+static void BM_BoundaryExpectedToResult(benchmark::State& state)
+{
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        xt::result<std::string, std::string> result{ make_expected(i++) };
+        benchmark::DoNotOptimize(result);
+    }
+}
+BENCHMARK(BM_BoundaryExpectedToResult);
+
+static void BM_BoundaryRoundTrip(benchmark::State& state)
+{
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        auto expected = xt::result<std::string, std::string>{ make_expected(i++) }.to_expected();
+        benchmark::DoNotOptimize(expected);
+    }
+}
+BENCHMARK(BM_BoundaryRoundTrip);
+
+//Hand-written unpack and re-wrap, the pattern the converting constructors replace, moving and reserving like to_results.
+static void BM_BulkManualRewrap(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        auto expecteds = make_expecteds();
+        state.ResumeTiming();
+
+        std::vector<xt::result<std::string, std::string>> results{ };
+        results.reserve(expecteds.size());
+        for (auto& expected : expecteds)
+        {
+            if (expected)
+                results.emplace_back(std::move(*expected));
+            else
+                results.emplace_back(xt::error<std::string>{ std::move(expected).error() });
+        }
+        benchmark::DoNotOptimize(results.data());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * element_count));
+}
+BENCHMARK(BM_BulkManualRewrap)->Unit(benchmark::kMicrosecond);
+
+static void BM_BulkToResults(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        auto expecteds = make_expecteds();
+        state.ResumeTiming();
+
+        auto results = xt::to_results(std::move(expecteds));
+        benchmark::DoNotOptimize(results.data());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * element_count));
+}
+BENCHMARK(BM_BulkToResults)->Unit(benchmark::kMicrosecond);
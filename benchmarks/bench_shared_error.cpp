@@ -0,0 +1,97 @@
+#include "allocation_counter.hpp"
+#include <result/shared_error.hpp>
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    //libstdc++ skips the atomic operations of std::shared_ptr until the process starts a thread.
+    //Fan-out happens in threaded programs, so leave that mode before measuring.
+    void leave_single_threaded_mode()
+    {
+        static const bool left = []
+        {
+            std::thread([] { }).join();
+            return true;
+        }();
+        static_cast<void>(left);
+    }
+
+    //Long enough to defeat the small string optimization.
+    const std::string message(96, 'x');
+
+    template <typename Err>
+    Err make_payload();
+
+    template <>
+    std::string make_payload<std::string>()
+    {
+        return message;
+    }
+
+    template <>
+    std::shared_ptr<const std::string> make_payload<std::shared_ptr<const std::string>>()
+    {
+        return std::make_shared<const std::string>(message);
+    }
+
+    template <>
+    xt::shared_error<std::string> make_payload<xt::shared_error<std::string>>()
+    {
+        return xt::make_shared_error<std::string>(message);
+    }
+
+    template <>
+    xt::shared_error<std::string, xt::local_refcount> make_payload<xt::shared_error<std::string, xt::local_refcount>>()
+    {
+        return xt::make_shared_error<std::string, xt::local_refcount>(message);
+    }
+}
+
+//One failure reported to N waiters, each waiter receives its own copy of the result.
+template <typename Err>
+static void BM_FanOut(benchmark::State& state)
+{
+    using result_type = xt::result<int, Err>;
+    leave_single_threaded_mode();
+    const auto waiters = static_cast<std::size_t>(state.range(0));
+    const result_type failed{ xt::error<Err>{ make_payload<Err>() } };
+
+    std::vector<result_type> delivered;
+    delivered.reserve(waiters);
+    const auto allocations = bench::allocation_count();
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < waiters; ++i)
+            delivered.push_back(failed);
+
+        benchmark::DoNotOptimize(delivered.data());
+        delivered.clear();
+    }
+    state.counters["allocs_per_copy"] = static_cast<double>(bench::allocation_count() - allocations) / static_cast<double>(state.iterations() * waiters);
+    state.counters["sizeof"] = static_cast<double>(sizeof(result_type));
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(waiters));
+}
+BENCHMARK(BM_FanOut<std::string>)->Arg(500);
+BENCHMARK(BM_FanOut<std::shared_ptr<const std::string>>)->Arg(500);
+BENCHMARK(BM_FanOut<xt::shared_error<std::string>>)->Arg(500);
+BENCHMARK(BM_FanOut<xt::shared_error<std::string, xt::local_refcount>>)->Arg(500);
+
+//Several threads copying and dropping the same error, the counter is contended.
+template <typename Err>
+static void BM_ConcurrentCopy(benchmark::State& state)
+{
+    static const Err shared = make_payload<Err>();
+    for (auto _ : state)
+    {
+        Err copy = shared;
+        benchmark::DoNotOptimize(copy);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ConcurrentCopy<std::string>)->ThreadRange(1, 8);
+BENCHMARK(BM_ConcurrentCopy<std::shared_ptr<const std::string>>)->ThreadRange(1, 8);
+BENCHMARK(BM_ConcurrentCopy<xt::shared_error<std::string>>)->ThreadRange(1, 8);
@@ -0,0 +1,71 @@
+#include <result/slim_result.hpp>
+#include <benchmark/benchmark.h>
+#include <string>
+#include <type_traits>
+
+namespace
+{
+    template <typename R>
+    constexpr bool returned_in_registers = std::is_trivially_copyable_v<R> && sizeof(R) <= 16;
+
+    [[gnu::noinline]] xt::result<int, std::string> parse_full(int input, int failure_every)
+    {
+        if (input % failure_every == 0)
+            return xt::error<std::string>{ "parse failed" };
+
+        return input * 2;
+    }
+
+    [[gnu::noinline]] xt::slim_result<int, std::string> parse_slim(int input, int failure_every)
+    {
+        if (input % failure_every == 0)
+            return xt::error<std::string>{ "parse failed" };
+
+        return input * 2;
+    }
+
+    template <typename R>
+    void report(benchmark::State& state)
+    {
+        state.counters["sizeof"] = static_cast<double>(sizeof(R));
+        state.counters["in_registers"] = returned_in_registers<R> ? 1 : 0;
+        state.SetItemsProcessed(state.iterations());
+    }
+}
+
+//Argument: one call in N fails.
+static void BM_FullResult(benchmark::State& state)
+{
+    const int failure_every = static_cast<int>(state.range(0));
+    int input = 1;
+    std::int64_t sum = 0;
+    for (auto _ : state)
+    {
+        const auto result = parse_full(input++, failure_every);
+        if (result.has_value())
+            sum += *result;
+        else
+            sum += static_cast<std::int64_t>(result.template get<1>()->size());
+    }
+    benchmark::DoNotOptimize(sum);
+    report<xt::result<int, std::string>>(state);
+}
+BENCHMARK(BM_FullResult)->Arg(1)->Arg(100)->Arg(1 << 20);
+
+static void BM_SlimResult(benchmark::State& state)
+{
+    const int failure_every = static_cast<int>(state.range(0));
+    int input = 1;
+    std::int64_t sum = 0;
+    for (auto _ : state)
+    {
+        auto result = parse_slim(input++, failure_every);
+        if (result.has_value())
+            sum += *result;
+        else
+            sum += static_cast<std::int64_t>(std::move(result).take_error().size());
+    }
+    benchmark::DoNotOptimize(sum);
+    report<xt::slim_result<int, std::string>>(state);
+}
+BENCHMARK(BM_SlimResult)->Arg(1)->Arg(100)->Arg(1 << 20);
@@ -0,0 +1,90 @@
+#include <result/exception.hpp>
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+    [[gnu::noinline]] int parse(int input, int failure_every)
+    {
+        if (input % failure_every == 0)
+            throw std::runtime_error("parse failed");
+
+        return input * 2;
+    }
+
+    //What callers write today at an exception boundary.
+    xt::result<int, std::string> parse_by_hand(int input, int failure_every)
+    {
+        try
+        {
+            return parse(input, failure_every);
+        }
+        catch (const std::exception& e)
+        {
+            return xt::error<std::string>{ e.what() };
+        }
+    }
+}
+
+//Argument: one call in N throws, 1 << 20 is effectively the non-throwing path.
+static void BM_HandWrittenTryCatch(benchmark::State& state)
+{
+    const int failure_every = static_cast<int>(state.range(0));
+    int input = 1;
+    std::int64_t sum = 0;
+    for (auto _ : state)
+    {
+        const auto result = parse_by_hand(input++, failure_every);
+        if (result.has_value())
+            sum += *result;
+        else
+            sum += static_cast<std::int64_t>(result.get_error().size());
+    }
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_HandWrittenTryCatch)->Arg(1 << 20)->Arg(100);
+
+static void BM_TryInvoke(benchmark::State& state)
+{
+    const int failure_every = static_cast<int>(state.range(0));
+    int input = 1;
+    std::int64_t sum = 0;
+    for (auto _ : state)
+    {
+        const auto result = xt::try_invoke<std::string>(parse, input++, failure_every);
+        if (result.has_value())
+            sum += *result;
+        else
+            sum += static_cast<std::int64_t>(result.get_error().size());
+    }
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TryInvoke)->Arg(1 << 20)->Arg(100);
+
+static void BM_ValueOrThrow(benchmark::State& state)
+{
+    const int failure_every = static_cast<int>(state.range(0));
+    int input = 1;
+    std::int64_t sum = 0;
+    for (auto _ : state)
+    {
+        const xt::result<int, std::string> result = (input % failure_every == 0) ? xt::result<int, std::string>{ xt::error<std::string>{ "parse failed" } }
+                                                                                 : xt::result<int, std::string>{ input * 2 };
+        ++input;
+        try
+        {
+            sum += result.value_or_throw();
+        }
+        catch (const xt::bad_result_access<std::string>& e)
+        {
+            sum += static_cast<std::int64_t>(e.error().size());
+        }
+    }
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ValueOrThrow)->Arg(1 << 20)->Arg(100);
@@ -0,0 +1,133 @@
+#include <result/views.hpp>
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+
+namespace
+{
+    std::vector<xt::result<std::int64_t, std::string>> make_results(std::size_t count)
+    {
+        std::vector<xt::result<std::int64_t, std::string>> results{ };
+        results.reserve(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            if (i % 8 == 0)
+                results.emplace_back(xt::error<std::string>{ "failure" });
+            else
+                results.emplace_back(static_cast<std::int64_t>(i));
+        }
+        return results;
+    }
+
+    //Only the last element fails, so the prefix after the first element spans count - 2 values.
+    std::vector<xt::result<std::int64_t, std::string>> make_prefix(std::size_t count)
+    {
+        std::vector<xt::result<std::int64_t, std::string>> results{ };
+        results.reserve(count);
+        for (std::size_t i = 0; i + 1 < count; ++i)
+            results.emplace_back(static_cast<std::int64_t>(i));
+
+        results.emplace_back(xt::error<std::string>{ "failure" });
+        return results;
+    }
+}
+
+static void BM_SumValuesLoop(benchmark::State& state)
+{
+    const auto results = make_results(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        std::int64_t sum = 0;
+        for (const auto& result : results)
+        {
+            if (result.has_value())
+                sum += *result;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SumValuesLoop)->Range(1 << 10, 1 << 20);
+
+static void BM_SumValuesView(benchmark::State& state)
+{
+    const auto results = make_results(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        std::int64_t sum = 0;
+        for (const std::int64_t value : results | xt::views::values)
+            sum += value;
+
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SumValuesView)->Range(1 << 10, 1 << 20);
+
+static void BM_CountErrorsLoop(benchmark::State& state)
+{
+    const auto results = make_results(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        std::size_t length = 0;
+        for (const auto& result : results)
+        {
+            if (!result.has_value())
+                length += result.template get<1>()->size();
+        }
+        benchmark::DoNotOptimize(length);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_CountErrorsLoop)->Range(1 << 10, 1 << 20);
+
+static void BM_CountErrorsView(benchmark::State& state)
+{
+    const auto results = make_results(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        std::size_t length = 0;
+        for (const std::string& error : results | xt::views::errors)
+            length += error.size();
+
+        benchmark::DoNotOptimize(length);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_CountErrorsView)->Range(1 << 10, 1 << 20);
+
+static void BM_PrefixSumLoop(benchmark::State& state)
+{
+    const auto results = make_prefix(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        std::int64_t sum = 0;
+        for (std::size_t i = 1; i < results.size() && results[i].has_value(); ++i)
+            sum += *results[i] * 2;
+
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * (state.range(0) - 2));
+}
+BENCHMARK(BM_PrefixSumLoop)->Range(1 << 10, 1 << 20);
+
+static void BM_PrefixSumView(benchmark::State& state)
+{
+    const auto results = make_prefix(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        std::int64_t sum = 0;
+        auto prefix = results
+            | std::views::drop(1)
+            | xt::views::take_until_error
+            | xt::views::transform_ok([](const std::int64_t value) { return value * 2; })
+            | xt::views::values;
+
+        for (const std::int64_t value : prefix)
+            sum += value;
+
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * (state.range(0) - 2));
+}
+BENCHMARK(BM_PrefixSumView)->Range(1 << 10, 1 << 20);
@@ -0,0 +1,278 @@
+#pragma once
+#include "result.hpp"
+#include <deque>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <concepts>
+#include <exception>
+#include <functional>
+#include <shared_mutex>
+#include <type_traits>
+#include <unordered_map>
+
+namespace xt
+{
+    struct result_cache_options
+    {
+        //How long a successful result stays cached.
+        std::chrono::steady_clock::duration value_ttl = std::chrono::minutes(5);
+
+        //How long an error stays cached, zero disables negative caching.
+        std::chrono::steady_clock::duration error_ttl = std::chrono::steady_clock::duration::zero();
+
+        //Rounded up to a power of two.
+        std::size_t shard_count = 16;
+
+        //Upper bound on cached entries, zero means unbounded. Split evenly between the shards.
+        std::size_t max_entries = 0;
+    };
+
+    namespace detail
+    {
+        //Fixed rather than std::hardware_destructive_interference_size, which may differ between translation units.
+        inline constexpr std::size_t cache_line_size = 64;
+
+        constexpr std::size_t round_up_pow2(std::size_t value) noexcept
+        {
+            std::size_t pow2 = 1;
+            while (pow2 < value)
+                pow2 <<= 1;
+
+            return pow2;
+        }
+    }  // namespace detail
+
+    //Thread-safe memoization of fallible computations.
+    //Keys are sharded by hash, concurrent misses for the same key share a single computation
+    //and results are handed out as shared handles so payloads are never copied.
+    template <typename K, typename T, typename E, typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>>
+    class result_cache
+    {
+    public:
+        using key_type = K;
+        using result_type = result<T, E>;
+        using handle = std::shared_ptr<const result_type>;
+        using clock = std::chrono::steady_clock;
+
+        explicit result_cache(result_cache_options options = { })
+            : m_options(options),
+              m_shard_count(detail::round_up_pow2(options.shard_count == 0 ? 1 : options.shard_count)),
+              m_shard_capacity(options.max_entries == 0 ? 0 : (options.max_entries + m_shard_count - 1) / m_shard_count),
+              m_shards(std::make_unique<shard[]>(m_shard_count))
+        {
+
+        }
+
+        result_cache(const result_cache&) = delete;
+        result_cache& operator=(const result_cache&) = delete;
+
+        //Returns the cached result for key, or runs compute(key) once no matter how many threads miss concurrently.
+        //If compute throws, every waiting caller receives the exception and nothing is cached.
+        template <typename F>
+            requires (std::invocable<F&, const K&> &&
+                      std::constructible_from<result_type, std::invoke_result_t<F&, const K&>>)
+        handle get_or_compute(const K& key, F&& compute)
+        {
+            shard& target = shard_for(key);
+            {
+                std::shared_lock lock(target.mutex);
+                if (handle cached = target.lookup(key, clock::now()))
+                    return cached;
+            }
+
+            std::promise<handle> promise{ };
+            {
+                std::unique_lock lock(target.mutex);
+                const auto now = clock::now();
+                if (handle cached = target.lookup(key, now))
+                    return cached;
+
+                if (const auto flight = target.in_flight.find(key); flight != target.in_flight.end())
+                {
+                    std::shared_future<handle> pending = flight->second;
+                    lock.unlock();
+                    return pending.get();
+                }
+
+                target.entries.erase(key);
+                target.in_flight.emplace(key, promise.get_future().share());
+            }
+
+            handle computed{ };
+            try
+            {
+                computed = std::make_shared<const result_type>(std::invoke(compute, key));
+            }
+            catch (...)
+            {
+                {
+                    std::unique_lock lock(target.mutex);
+                    target.in_flight.erase(key);
+                }
+                promise.set_exception(std::current_exception());
+                throw;
+            }
+
+            {
+                std::unique_lock lock(target.mutex);
+                target.in_flight.erase(key);
+
+                const auto ttl = computed->has_value() ? m_options.value_ttl : m_options.error_ttl;
+                if (ttl > clock::duration::zero())
+                    target.store(key, computed, clock::now(), ttl, m_shard_capacity);
+            }
+
+            promise.set_value(computed);
+            return computed;
+        }
+
+        //Returns the cached result for key, or an empty handle when missing or expired.
+        handle find(const K& key) const
+        {
+            const shard& target = shard_for(key);
+            std::shared_lock lock(target.mutex);
+            return target.lookup(key, clock::now());
+        }
+
+        void erase(const K& key)
+        {
+            shard& target = shard_for(key);
+            std::unique_lock lock(target.mutex);
+            target.entries.erase(key);
+        }
+
+        void clear()
+        {
+            for (std::size_t i = 0; i < m_shard_count; ++i)
+            {
+                std::unique_lock lock(m_shards[i].mutex);
+                m_shards[i].entries.clear();
+                m_shards[i].value_expiries.clear();
+                m_shards[i].error_expiries.clear();
+            }
+        }
+
+        //Number of stored entries, including ones that expired since the last insert into their shard.
+        std::size_t size() const
+        {
+            std::size_t total = 0;
+            for (std::size_t i = 0; i < m_shard_count; ++i)
+            {
+                std::shared_lock lock(m_shards[i].mutex);
+                total += m_shards[i].entries.size();
+            }
+            return total;
+        }
+
+        std::size_t shard_count() const noexcept
+        {
+            return m_shard_count;
+        }
+
+    private:
+        struct entry
+        {
+            handle value;
+            clock::time_point expires_at;
+        };
+
+        struct expiry
+        {
+            K key;
+            clock::time_point expires_at;
+        };
+
+        struct alignas(detail::cache_line_size) shard
+        {
+            mutable std::shared_mutex mutex;
+            std::unordered_map<K, entry, Hash, KeyEqual> entries;
+            std::unordered_map<K, std::shared_future<handle>, Hash, KeyEqual> in_flight;
+
+            //Every entry is queued by the TTL it was stored with. All entries of one TTL expire in the order
+            //they were stored, so each queue is sorted and expired entries are always at the front.
+            std::deque<expiry> value_expiries;
+            std::deque<expiry> error_expiries;
+
+            handle lookup(const K& key, clock::time_point now) const
+            {
+                const auto found = entries.find(key);
+                if (found == entries.end() || found->second.expires_at <= now)
+                    return nullptr;
+
+                return found->second.value;
+            }
+
+            //Drops every expired entry first, then evicts the entry closest to expiring if the shard is still full.
+            void store(const K& key, handle value, clock::time_point now, clock::duration ttl, std::size_t capacity)
+            {
+                drop_expired(value_expiries, now);
+                drop_expired(error_expiries, now);
+                if (capacity != 0 && entries.size() >= capacity)
+                    evict_soonest();
+
+                const auto expires_at = now + ttl;
+                auto& expiries = value->has_value() ? value_expiries : error_expiries;
+                expiries.push_back(expiry{ key, expires_at });
+                entries.insert_or_assign(key, entry{ std::move(value), expires_at });
+            }
+
+            void drop_expired(std::deque<expiry>& expiries, clock::time_point now)
+            {
+                while (!expiries.empty() && expiries.front().expires_at <= now)
+                    pop_expiry(expiries);
+            }
+
+            void evict_soonest()
+            {
+                while (!value_expiries.empty() || !error_expiries.empty())
+                {
+                    const bool value_first = error_expiries.empty() ||
+                        (!value_expiries.empty() && value_expiries.front().expires_at <= error_expiries.front().expires_at);
+                    if (pop_expiry(value_first ? value_expiries : error_expiries))
+                        return;
+                }
+            }
+
+            //Erases the entry of the oldest queued expiry unless that key was erased or stored again since.
+            bool pop_expiry(std::deque<expiry>& expiries)
+            {
+                const auto found = entries.find(expiries.front().key);
+                const bool current = found != entries.end() && found->second.expires_at == expiries.front().expires_at;
+                if (current)
+                    entries.erase(found);
+
+                expiries.pop_front();
+                return current;
+            }
+        };
+
+        shard& shard_for(const K& key)
+        {
+            return m_shards[shard_index(key)];
+        }
+
+        const shard& shard_for(const K& key) const
+        {
+            return m_shards[shard_index(key)];
+        }
+
+        std::size_t shard_index(const K& key) const
+        {
+            //Mix the hash so identity hashes of integers still spread across shards.
+            std::uint64_t hash = static_cast<std::uint64_t>(Hash{ }(key));
+            hash ^= hash >> 33;
+            hash *= 0xff51afd7ed558ccdull;
+            hash ^= hash >> 33;
+            return static_cast<std::size_t>(hash) & (m_shard_count - 1);
+        }
+
+        result_cache_options m_options;
+        std::size_t m_shard_count;
+        std::size_t m_shard_capacity;
+        std::unique_ptr<shard[]> m_shards;
+    };
+}  // namespace xt
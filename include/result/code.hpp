@@ -0,0 +1,255 @@
+#pragma once
+#include "result.hpp"
+#include <deque>
+#include <mutex>
+#include <string>
+#include <cstddef>
+#include <cstdint>
+#include <compare>
+#include <stdexcept>
+#include <algorithm>
+#include <functional>
+#include <string_view>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace xt
+{
+    //A 32-bit interned error identity, cheap enough to use directly as the Err of a result.
+    //The category and message are stored once in code_registry and only looked up on demand.
+    //The default constructed code (id 0) means "no error".
+    class code
+    {
+    public:
+        using id_type = std::uint32_t;
+
+        constexpr code() noexcept = default;
+
+        constexpr explicit code(id_type id) noexcept
+            : m_id(id)
+        {
+
+        }
+
+        //Interns category and message at runtime, returning the same code for the same pair.
+        static code intern(std::string_view category, std::string_view message);
+
+        constexpr id_type id() const noexcept
+        {
+            return m_id;
+        }
+
+        constexpr explicit operator bool() const noexcept
+        {
+            return m_id != 0;
+        }
+
+        //Empty for codes that were never registered.
+        std::string_view category() const;
+        std::string_view message() const;
+
+        friend constexpr bool operator==(code, code) noexcept = default;
+        friend constexpr std::strong_ordering operator<=>(code, code) noexcept = default;
+
+    private:
+        id_type m_id = 0;
+    };
+
+    namespace detail
+    {
+        //Ids with this bit set are only handed out by code::intern() after a hash collision, so a runtime
+        //collision can never take the id of a compile time code that has not been registered yet.
+        inline constexpr code::id_type probed_code_bit = 0x80000000u;
+
+        //FNV-1a over category, a separator and message, without probed_code_bit. Zero is reserved for "no error".
+        constexpr code::id_type hash_code(std::string_view category, std::string_view message) noexcept
+        {
+            std::uint32_t hash = 2166136261u;
+            const auto mix = [&hash](unsigned char byte)
+            {
+                hash ^= byte;
+                hash *= 16777619u;
+            };
+
+            for (const char c : category)
+                mix(static_cast<unsigned char>(c));
+
+            mix(0);
+            for (const char c : message)
+                mix(static_cast<unsigned char>(c));
+
+            hash &= ~probed_code_bit;
+            return hash == 0 ? 1 : hash;
+        }
+
+        template <std::size_t N>
+        struct fixed_string
+        {
+            char data[N]{ };
+
+            constexpr fixed_string(const char (&str)[N]) noexcept
+            {
+                std::copy_n(str, N, data);
+            }
+
+            constexpr std::string_view view() const noexcept
+            {
+                return { data, N - 1 };
+            }
+        };
+    }  // namespace detail
+
+    class code_registry
+    {
+    public:
+        struct entry
+        {
+            std::string_view category;
+            std::string_view message;
+        };
+
+        static code_registry& instance()
+        {
+            static code_registry registry{ };
+            return registry;
+        }
+
+        //Registers text with static storage duration under its precomputed id without copying it.
+        //Throws std::logic_error, in every build mode, when the id already names different text. The id of a
+        //compile time code cannot move, so a genuine hash collision must be fixed by rewording one of the codes.
+        code add_static(code::id_type id, std::string_view category, std::string_view message)
+        {
+            std::unique_lock lock(m_mutex);
+            const auto [found, inserted] = m_entries.try_emplace(id, entry{ category, message });
+            if (!inserted && (found->second.category != category || found->second.message != message))
+            {
+                throw std::logic_error("xt::code hash collision between \"" + std::string(category) + ": " + std::string(message) +
+                                       "\" and \"" + std::string(found->second.category) + ": " + std::string(found->second.message) + "\"");
+            }
+            return code{ id };
+        }
+
+        //Copies the text once. The same text always maps to its hash id, so it matches the compile time code
+        //for that text. After a hash collision with different text the id is probed among ids with
+        //detail::probed_code_bit set, which compile time codes never use.
+        code intern(std::string_view category, std::string_view message)
+        {
+            code::id_type id = detail::hash_code(category, message);
+            {
+                std::shared_lock lock(m_mutex);
+                if (const auto found = probe(id, category, message); found.second)
+                    return code{ found.first };
+            }
+
+            std::unique_lock lock(m_mutex);
+            const auto [free_id, exists] = probe(id, category, message);
+            if (!exists)
+            {
+                const std::string& owned_category = m_storage.emplace_back(category);
+                const std::string& owned_message = m_storage.emplace_back(message);
+                m_entries.emplace(free_id, entry{ owned_category, owned_message });
+            }
+            return code{ free_id };
+        }
+
+        const entry* find(code c) const
+        {
+            std::shared_lock lock(m_mutex);
+            const auto found = m_entries.find(c.id());
+            return found == m_entries.end() ? nullptr : &found->second;
+        }
+
+    private:
+        code_registry() = default;
+
+        //Returns the id holding this text (true) or the first free id along the probe sequence (false).
+        //The sequence is the hash id itself followed by ids with detail::probed_code_bit set.
+        std::pair<code::id_type, bool> probe(code::id_type id, std::string_view category, std::string_view message) const
+        {
+            for (;; id = next_probe(id))
+            {
+                const auto found = m_entries.find(id);
+                if (found == m_entries.end())
+                    return { id, false };
+
+                if (found->second.category == category && found->second.message == message)
+                    return { id, true };
+            }
+        }
+
+        static constexpr code::id_type next_probe(code::id_type id) noexcept
+        {
+            if (!(id & detail::probed_code_bit))
+                return id | detail::probed_code_bit;
+
+            return id == UINT32_MAX ? detail::probed_code_bit : id + 1;
+        }
+
+        mutable std::shared_mutex m_mutex;
+        std::unordered_map<code::id_type, entry> m_entries;
+        std::deque<std::string> m_storage;
+    };
+
+    inline code code::intern(std::string_view category, std::string_view message)
+    {
+        return code_registry::instance().intern(category, message);
+    }
+
+    inline std::string_view code::category() const
+    {
+        const auto* found = code_registry::instance().find(*this);
+        return found ? found->category : std::string_view{ };
+    }
+
+    inline std::string_view code::message() const
+    {
+        const auto* found = code_registry::instance().find(*this);
+        return found ? found->message : std::string_view{ };
+    }
+
+    namespace detail
+    {
+        template <fixed_string Category, fixed_string Message>
+        struct static_code
+        {
+            static constexpr code::id_type id = hash_code(Category.view(), Message.view());
+
+            //Dynamically initialized at startup for every code named through make_code.
+            static inline const code registered = code_registry::instance().add_static(id, Category.view(), Message.view());
+        };
+    }  // namespace detail
+
+    //Compile time code, usable in constant expressions. Its text is registered at program startup.
+    template <detail::fixed_string Category, detail::fixed_string Message>
+    constexpr code make_code() noexcept
+    {
+        if !consteval
+        {
+            static_cast<void>(detail::static_code<Category, Message>::registered);
+        }
+        return code{ detail::static_code<Category, Message>::id };
+    }
+
+    template <>
+    struct error_traits<code>
+    {
+        static constexpr bool has_empty_state = true;
+
+        static constexpr bool is_empty(const code& c) noexcept
+        {
+            return !c;
+        }
+    };
+}  // namespace xt
+
+namespace std
+{
+    template <>
+    struct hash<xt::code>
+    {
+        size_t operator()(const xt::code c) const noexcept
+        {
+            return hash<xt::code::id_type>{ }(c.id());
+        }
+    };
+}
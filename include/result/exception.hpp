@@ -0,0 +1,155 @@
+#pragma once
+#include "result.hpp"
+#include <string>
+#include <utility>
+#include <variant>
+#include <concepts>
+#include <exception>
+#include <functional>
+#include <type_traits>
+
+namespace xt
+{
+    //Thrown by result::value_or_throw() when the result holds an error.
+    template <typename Err>
+    class bad_result_access : public std::exception
+    {
+    public:
+        explicit bad_result_access(Err err)
+            : m_error(std::move(err))
+        {
+
+        }
+
+        const char* what() const noexcept override
+        {
+            return "xt::result accessed without a value";
+        }
+
+        const Err& error() const& noexcept
+        {
+            return m_error;
+        }
+
+        Err&& error() && noexcept
+        {
+            return std::move(m_error);
+        }
+
+    private:
+        Err m_error;
+    };
+
+    //Maps the exception currently being handled to an Err, used by try_invoke<Err>.
+    //It is called from inside the catch handler, so it may use `throw;` to inspect the exception.
+    //Specialize it for your own error types.
+    template <typename Err>
+    struct exception_mapper;
+
+    template <>
+    struct exception_mapper<std::exception_ptr>
+    {
+        std::exception_ptr operator()() const noexcept
+        {
+            return std::current_exception();
+        }
+    };
+
+    template <>
+    struct exception_mapper<std::string>
+    {
+        std::string operator()(const std::exception& e) const
+        {
+            return e.what();
+        }
+
+        std::string operator()() const
+        {
+            try
+            {
+                throw;
+            }
+            catch (const std::exception& e)
+            {
+                return e.what();
+            }
+            catch (...)
+            {
+                return "unknown exception";
+            }
+        }
+    };
+
+    namespace detail
+    {
+        //result cannot hold void, callables returning nothing yield std::monostate instead.
+        //References are returned by value, result does not hold them.
+        template <typename Fn, typename... Args>
+        using invoke_value_t = std::conditional_t<std::is_void_v<std::invoke_result_t<Fn, Args...>>,
+                                                  std::monostate,
+                                                  std::remove_cvref_t<std::invoke_result_t<Fn, Args...>>>;
+
+        template <typename Result, typename Fn, typename... Args>
+        constexpr Result invoke_into_result(Fn&& fn, Args&&... args)
+        {
+            if constexpr (std::is_void_v<std::invoke_result_t<Fn, Args...>>)
+            {
+                std::invoke(std::forward<Fn>(fn), std::forward<Args>(args)...);
+                return Result(std::in_place);
+            }
+            else
+            {
+                return Result(std::in_place, std::invoke(std::forward<Fn>(fn), std::forward<Args>(args)...));
+            }
+        }
+    }  // namespace detail
+
+    //Runs a callable that may throw and maps any exception to an error with mapper().
+    //A mapper also invocable with const std::exception& receives std::exception types directly, without a rethrow.
+    //Callables that are noexcept skip the try/catch entirely.
+    template <typename Mapper, typename Fn, typename... Args>
+        requires (std::invocable<Fn, Args...> && std::invocable<Mapper&>)
+    auto try_invoke_with(Mapper&& mapper, Fn&& fn, Args&&... args)
+        -> result<detail::invoke_value_t<Fn, Args...>, std::remove_cvref_t<std::invoke_result_t<Mapper&>>>
+    {
+        using error_type = std::remove_cvref_t<std::invoke_result_t<Mapper&>>;
+        using result_type = result<detail::invoke_value_t<Fn, Args...>, error_type>;
+        if constexpr (std::is_nothrow_invocable_v<Fn, Args...>)
+        {
+            return detail::invoke_into_result<result_type>(std::forward<Fn>(fn), std::forward<Args>(args)...);
+        }
+        else if constexpr (std::invocable<Mapper&, const std::exception&>)
+        {
+            try
+            {
+                return detail::invoke_into_result<result_type>(std::forward<Fn>(fn), std::forward<Args>(args)...);
+            }
+            catch (const std::exception& e)
+            {
+                return result_type(error<error_type>(std::in_place, std::invoke(mapper, e)));
+            }
+            catch (...)
+            {
+                return result_type(error<error_type>(std::in_place, std::invoke(mapper)));
+            }
+        }
+        else
+        {
+            try
+            {
+                return detail::invoke_into_result<result_type>(std::forward<Fn>(fn), std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                return result_type(error<error_type>(std::in_place, std::invoke(mapper)));
+            }
+        }
+    }
+
+    template <typename Err, typename Fn, typename... Args>
+        requires std::invocable<Fn, Args...>
+    result<detail::invoke_value_t<Fn, Args...>, Err> try_invoke(Fn&& fn, Args&&... args)
+    {
+        return try_invoke_with(exception_mapper<Err>{ }, std::forward<Fn>(fn), std::forward<Args>(args)...);
+    }
+}  // namespace xt
@@ -0,0 +1,170 @@
+#pragma once
+#include "result.hpp"
+#include <format>
+#include <string_view>
+#include <type_traits>
+
+namespace xt::detail
+{
+    enum class format_mode
+    {
+        standard,   // {}    value if present, otherwise the error
+        value,      // {:v}  value only, nothing when holding an error
+        error,      // {:e}  error only, nothing when holding a value
+        debug       // {:?}  ok(value) / error(error)
+    };
+
+    template <typename T, typename CharT>
+    concept has_formatter = std::is_default_constructible_v<std::formatter<T, CharT>>;
+
+    //Writes a plain ASCII literal straight into the output iterator, no intermediate string.
+    template <typename CharT, typename Out>
+    constexpr Out write_literal(Out out, std::string_view text)
+    {
+        for (const char c : text)
+            *out++ = static_cast<CharT>(c);
+
+        return out;
+    }
+
+    template <typename Formatter>
+    constexpr void enable_debug_format(Formatter& formatter)
+    {
+        if constexpr (requires { formatter.set_debug_format(); })
+            formatter.set_debug_format();
+    }
+
+    template <typename CharT, typename Formatter, typename T, typename FormatContext>
+    auto format_wrapped(const Formatter& formatter, std::string_view prefix, const T& value, FormatContext& ctx)
+    {
+        ctx.advance_to(write_literal<CharT>(ctx.out(), prefix));
+        ctx.advance_to(formatter.format(value, ctx));
+        return write_literal<CharT>(ctx.out(), ")");
+    }
+}  // namespace xt::detail
+
+//Format specification: [v|e|?][:nested-spec]
+//A nested specification is only accepted after 'v' or 'e' and is forwarded to the value or error formatter alone.
+template <typename Ty, typename Err, typename CharT>
+    requires (xt::detail::has_formatter<Ty, CharT> && xt::detail::has_formatter<Err, CharT>)
+struct std::formatter<xt::result<Ty, Err>, CharT>
+{
+    constexpr auto parse(std::basic_format_parse_context<CharT>& ctx)
+    {
+        auto it = ctx.begin();
+        if (it != ctx.end())
+        {
+            switch (*it)
+            {
+            case 'v': m_mode = xt::detail::format_mode::value; ++it; break;
+            case 'e': m_mode = xt::detail::format_mode::error; ++it; break;
+            case '?': m_mode = xt::detail::format_mode::debug; ++it; break;
+            default: break;
+            }
+        }
+
+        const bool nested = m_mode == xt::detail::format_mode::value || m_mode == xt::detail::format_mode::error;
+        if (nested && it != ctx.end() && *it == ':')
+            ++it;
+
+        if (!nested && it != ctx.end() && *it != '}')
+            throw std::format_error("A nested specification for xt::result is only accepted after 'v' or 'e'.");
+
+        //Exactly one formatter consumes a nested specification, so dynamic width or precision takes one argument.
+        //Without one, both formatters parse the empty specification.
+        ctx.advance_to(it);
+        if (m_mode == xt::detail::format_mode::value)
+        {
+            it = m_value_formatter.parse(ctx);
+        }
+        else if (m_mode == xt::detail::format_mode::error)
+        {
+            it = m_error_formatter.parse(ctx);
+        }
+        else
+        {
+            m_value_formatter.parse(ctx);
+            it = m_error_formatter.parse(ctx);
+        }
+
+        if (it != ctx.end() && *it != '}')
+            throw std::format_error("Invalid format specification for xt::result.");
+
+        if (m_mode == xt::detail::format_mode::debug)
+        {
+            xt::detail::enable_debug_format(m_value_formatter);
+            xt::detail::enable_debug_format(m_error_formatter);
+        }
+
+        return it;
+    }
+
+    template <typename FormatContext>
+    auto format(const xt::result<Ty, Err>& res, FormatContext& ctx) const
+    {
+        const auto& [value, error] = res;
+        switch (m_mode)
+        {
+        case xt::detail::format_mode::value:
+            return res.has_value() ? m_value_formatter.format(value, ctx) : ctx.out();
+        case xt::detail::format_mode::error:
+            return res.has_value() ? ctx.out() : m_error_formatter.format(*error, ctx);
+        case xt::detail::format_mode::debug:
+            if (res.has_value())
+                return xt::detail::format_wrapped<CharT>(m_value_formatter, "ok(", value, ctx);
+
+            return xt::detail::format_wrapped<CharT>(m_error_formatter, "error(", *error, ctx);
+        default:
+            return res.has_value() ? m_value_formatter.format(value, ctx) : m_error_formatter.format(*error, ctx);
+        }
+    }
+
+private:
+    xt::detail::format_mode m_mode = xt::detail::format_mode::standard;
+    std::formatter<Ty, CharT> m_value_formatter;
+    std::formatter<Err, CharT> m_error_formatter;
+};
+
+//Format specification: ? for the debug form, anything else is forwarded to the error formatter.
+//An empty error formats as nothing, or as error() in the debug form.
+template <typename Err, typename CharT>
+    requires xt::detail::has_formatter<Err, CharT>
+struct std::formatter<xt::error<Err>, CharT>
+{
+    constexpr auto parse(std::basic_format_parse_context<CharT>& ctx)
+    {
+        auto it = ctx.begin();
+        if (it != ctx.end() && *it == '?')
+        {
+            m_debug = true;
+            ctx.advance_to(++it);
+        }
+
+        it = m_error_formatter.parse(ctx);
+        if (m_debug)
+        {
+            if (it != ctx.end() && *it != '}')
+                throw std::format_error("Invalid format specification for xt::error.");
+
+            xt::detail::enable_debug_format(m_error_formatter);
+        }
+
+        return it;
+    }
+
+    template <typename FormatContext>
+    auto format(const xt::error<Err>& err, FormatContext& ctx) const
+    {
+        if (!m_debug)
+            return err ? m_error_formatter.format(*err, ctx) : ctx.out();
+
+        if (!err)
+            return xt::detail::write_literal<CharT>(ctx.out(), "error()");
+
+        return xt::detail::format_wrapped<CharT>(m_error_formatter, "error(", *err, ctx);
+    }
+
+private:
+    bool m_debug = false;
+    std::formatter<Err, CharT> m_error_formatter;
+};
@@ -0,0 +1,69 @@
+#pragma once
+#include "result.hpp"
+#include <vector>
+#include <ranges>
+#include <utility>
+#include <expected>
+#include <type_traits>
+
+namespace xt
+{
+    namespace detail
+    {
+        template <typename T>
+        struct is_expected : std::false_type
+        {
+        };
+
+        template <typename T, typename E>
+        struct is_expected<std::expected<T, E>> : std::true_type
+        {
+        };
+
+        //Elements of an owning range passed as an rvalue are moved, everything else is forwarded as-is.
+        template <typename R>
+        constexpr bool moves_elements = !std::is_lvalue_reference_v<R> && !std::ranges::view<std::remove_cvref_t<R>>;
+
+        template <typename R, typename Out, typename Convert>
+        std::vector<Out> convert_range(R&& range, Convert convert)
+        {
+            std::vector<Out> converted{ };
+            if constexpr (std::ranges::sized_range<R>)
+                converted.reserve(std::ranges::size(range));
+
+            for (auto&& element : range)
+            {
+                if constexpr (moves_elements<R>)
+                    converted.emplace_back(convert(std::move(element)));
+                else
+                    converted.emplace_back(convert(std::forward<decltype(element)>(element)));
+            }
+            return converted;
+        }
+    }  // namespace detail
+
+    //Converts a range of std::expected into a vector of results in one allocation.
+    template <std::ranges::input_range R>
+        requires detail::is_expected<std::ranges::range_value_t<R>>::value
+    auto to_results(R&& range)
+    {
+        using expected_type = std::ranges::range_value_t<R>;
+        using result_type = result<typename expected_type::value_type, typename expected_type::error_type>;
+        return detail::convert_range<R, result_type>(std::forward<R>(range), [](auto&& expected) -> decltype(auto)
+        {
+            return std::forward<decltype(expected)>(expected);
+        });
+    }
+
+    //Converts a range of results into a vector of std::expected in one allocation.
+    template <std::ranges::input_range R>
+        requires detail::is_result<std::ranges::range_value_t<R>>::value
+    auto to_expected(R&& range)
+    {
+        using result_type = std::ranges::range_value_t<R>;
+        return detail::convert_range<R, decltype(std::declval<const result_type&>().to_expected())>(std::forward<R>(range), [](auto&& result)
+        {
+            return std::forward<decltype(result)>(result).to_expected();
+        });
+    }
+}  // namespace xt
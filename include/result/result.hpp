@@ -2,11 +2,49 @@
 #include <cstddef>
 #include <tuple>
 #include <utility>
+#include <compare>
+#include <concepts>
+#include <optional>
+#include <stdexcept>
+#include <expected>
+#include <functional>
 #include <type_traits>
 #include <initializer_list>
 
+#if defined(_MSC_VER)
+#define XT_NO_UNIQUE_ADDRESS [[msvc::no_unique_address]]
+#else
+#define XT_NO_UNIQUE_ADDRESS [[no_unique_address]]
+#endif
+
 namespace xt
 {
+    //Error payloads with a reserved "no error" value can specialize this trait to drop the
+    //separate engaged flag from error<Err>, which then takes exactly sizeof(Err).
+    //A default constructed Err must be that empty value. Constructing an engaged error<Err> from it
+    //throws std::invalid_argument.
+    template <typename Err>
+    struct error_traits
+    {
+        static constexpr bool has_empty_state = false;
+
+        //Only consulted when has_empty_state is true.
+        static constexpr bool is_empty(const Err&) noexcept
+        {
+            return false;
+        }
+    };
+
+    namespace detail
+    {
+        struct empty_flag
+        {
+            constexpr empty_flag(bool) noexcept
+            {
+            }
+        };
+    }  // namespace detail
+
     template <typename Err>
     class error
     {
@@ -20,7 +58,7 @@ namespace xt
         constexpr explicit error(UErr&& err) 
             : m_has_error(true), m_error(std::forward<UErr>(err))
         {
-
+            check_engaged();
         }
 
         template <class... Args>
@@ -28,7 +66,7 @@ namespace xt
         constexpr explicit error(std::in_place_t, Args&&... values)
             : m_has_error(true), m_error(std::forward<Args>(values)...)
         {
-
+            check_engaged();
         }
 
         template <class UTy, class... Args>
@@ -36,48 +74,55 @@ namespace xt
         constexpr explicit error(std::in_place_t, std::initializer_list<UTy> list, Args&&... values)
             : m_has_error(true), m_error(list, std::forward<Args>(values)...)
         {
-
+            check_engaged();
         }
 
         template <typename UErr>
             requires(std::constructible_from<Err, const UErr&> &&
                      !std::is_same_v<std::remove_cvref_t<UErr>, error>)
         constexpr explicit(!std::is_convertible_v<const UErr&, Err>) error(const error<UErr>& other)
-            : m_has_error(other)
+            : error(static_cast<bool>(other), other)
         {
-            if (m_has_error)
-            {
-                m_error = { (*other) };
-            }
-            else
-            {
-                m_error = {};
-            }
+
         }
 
         template <typename UErr>
             requires(std::constructible_from<Err, UErr> &&
                      !std::is_same_v<std::remove_cvref_t<UErr>, error>)
         constexpr explicit(!std::is_convertible_v<UErr, Err>) error(error<UErr>&& other)
-            : m_has_error(other)
+            : error(static_cast<bool>(other), std::move(other))
         {
-            if (m_has_error)
-            {
-                m_error = { (*other) };
-            }
-            else
-            {
-                m_error = {};
-            }
+
+        }
+
+        //Unexpected-Start
+        template <class UErr>
+            requires(std::constructible_from<Err, const UErr&>)
+        constexpr explicit(!std::is_convertible_v<const UErr&, Err>) error(const std::unexpected<UErr>& unexpected)
+            : m_has_error(true), m_error(unexpected.error())
+        {
+            check_engaged();
         }
 
+        template <class UErr>
+            requires(std::constructible_from<Err, UErr>)
+        constexpr explicit(!std::is_convertible_v<UErr, Err>) error(std::unexpected<UErr>&& unexpected)
+            : m_has_error(true), m_error(std::move(unexpected).error())
+        {
+            check_engaged();
+        }
+        //Unexpected-End
+
         error() : m_has_error(false), m_error()
         {
         }
 
         operator bool() const
         {
-            return m_has_error;
+            if constexpr (error_traits<Err>::has_empty_state)
+                return !error_traits<Err>::is_empty(m_error);
+            else
+                return m_has_error;
         }
 
         const Err* operator->() const
@@ -110,9 +155,50 @@ namespace xt
             return std::move(m_error);
         }
 
+        //Comparison
+        //An empty error compares equal to another empty error and orders before any engaged error.
+        template <typename UErr>
+            requires std::equality_comparable_with<Err, UErr>
+        friend constexpr bool operator==(const error& lhs, const error<UErr>& rhs)
+        {
+            if (static_cast<bool>(lhs) != static_cast<bool>(rhs))
+                return false;
+
+            return !lhs || *lhs == *rhs;
+        }
+
+        template <typename UErr>
+            requires std::three_way_comparable_with<Err, UErr>
+        friend constexpr std::compare_three_way_result_t<Err, UErr> operator<=>(const error& lhs, const error<UErr>& rhs)
+        {
+            if (lhs && rhs)
+                return *lhs <=> *rhs;
+
+            return static_cast<bool>(lhs) <=> static_cast<bool>(rhs);
+        }
+
     private:
+        //Converting constructors read whether other is engaged before its payload is moved from.
+        template <class Other>
+        constexpr error(bool engaged, Other&& other)
+            : m_error(engaged ? Err(*std::forward<Other>(other)) : Err()), m_has_error(engaged)
+        {
+            if (engaged)
+                check_engaged();
+        }
+
+        //An engaged error holding the reserved "no error" value would read as a success.
+        constexpr void check_engaged() const
+        {
+            if constexpr (error_traits<Err>::has_empty_state)
+            {
+                if (error_traits<Err>::is_empty(m_error))
+                    throw std::invalid_argument("xt::error cannot hold the empty value of its payload");
+            }
+        }
+
         Err m_error;
-        bool m_has_error;
+        XT_NO_UNIQUE_ADDRESS std::conditional_t<error_traits<Err>::has_empty_state, detail::empty_flag, bool> m_has_error;
     };
 
     template <class Err>
@@ -142,6 +228,10 @@ namespace xt
         return { std::forward<E>(err) };
     }
 
+    //Defined in <result/exception.hpp>, which value_or_throw() without a mapper requires.
+    template <typename Err>
+    class bad_result_access;
+
     template <typename Ty, typename Err>
     class result
     {
@@ -163,13 +253,13 @@ namespace xt
         }
 
         constexpr result(const result& other)
-            : m_value(other.m_value), m_error()
+            : m_value(other.m_value), m_error(other.m_error)
         {
 
         }
 
-        constexpr result(const result&& other) noexcept
-            : m_value(std::move(other.m_value)), m_error()
+        constexpr result(result&& other) noexcept(std::is_nothrow_move_constructible_v<Ty> && std::is_nothrow_move_constructible_v<Err>)
+            : m_value(std::move(other.m_value)), m_error(std::move(other.m_error))
         {
 
         }
@@ -179,7 +269,7 @@ namespace xt
                        std::constructible_from<Ty, UTy> &&
                        std::constructible_from<Err, UErr>)
         constexpr explicit(!std::is_convertible_v<const UTy&, Ty> || !std::is_convertible_v<const UErr&, Err>) result(const result<UTy, UErr>& other)
-            : m_value(other.m_value), m_error()
+            : m_value(other.has_value() ? Ty(other.m_value) : Ty()), m_error(other.m_error)
         {
 
         }
@@ -189,7 +279,7 @@ namespace xt
                        std::constructible_from<Ty, UTy> &&
                        std::constructible_from<Err, UErr>)
         constexpr explicit(!std::is_convertible_v<const UTy&, Ty> || !std::is_convertible_v<const UErr&, Err>) result(result<UTy, UErr>&& other)
-            : m_value(std::move(other.m_value)), m_error()
+            : m_value(other.has_value() ? Ty(std::move(other.m_value)) : Ty()), m_error(std::move(other.m_error))
         {
 
         }
@@ -259,6 +349,45 @@ namespace xt
         }
         //Failure-End
 
+        //Expected-Start
+        //Only the active alternative is copied or moved, the other member is default constructed.
+        template <class UTy, class UErr>
+            requires (std::constructible_from<Ty, const UTy&> &&
+                      std::constructible_from<Err, const UErr&>)
+        constexpr explicit(!std::is_convertible_v<const UTy&, Ty> || !std::is_convertible_v<const UErr&, Err>) result(const std::expected<UTy, UErr>& expected)
+            : m_value(expected.has_value() ? Ty(*expected) : Ty()),
+              m_error(expected.has_value() ? error<Err>() : error<Err>(std::in_place, expected.error()))
+        {
+
+        }
+
+        template <class UTy, class UErr>
+            requires (std::constructible_from<Ty, UTy> &&
+                      std::constructible_from<Err, UErr>)
+        constexpr explicit(!std::is_convertible_v<UTy, Ty> || !std::is_convertible_v<UErr, Err>) result(std::expected<UTy, UErr>&& expected)
+            : m_value(expected.has_value() ? Ty(*std::move(expected)) : Ty()),
+              m_error(expected.has_value() ? error<Err>() : error<Err>(std::in_place, std::move(expected).error()))
+        {
+
+        }
+
+        template <class UErr>
+            requires (std::constructible_from<Err, const UErr&>)
+        constexpr explicit(!std::is_convertible_v<const UErr&, Err>) result(const std::unexpected<UErr>& unexpected)
+            : m_value(), m_error(std::in_place, unexpected.error())
+        {
+
+        }
+
+        template <class UErr>
+            requires (std::constructible_from<Err, UErr>)
+        constexpr explicit(!std::is_convertible_v<UErr, Err>) result(std::unexpected<UErr>&& unexpected)
+            : m_value(), m_error(std::in_place, std::move(unexpected).error())
+        {
+
+        }
+        //Expected-End
+
         operator bool() const
         {
             return !(m_error);
@@ -279,6 +408,95 @@ namespace xt
             return *m_error;
         }
 
+        std::expected<value_type, error_type> to_expected() const&
+        {
+            if (has_value())
+                return std::expected<value_type, error_type>(std::in_place, m_value);
+
+            return std::expected<value_type, error_type>(std::unexpect, *m_error);
+        }
+
+        std::expected<value_type, error_type> to_expected() &&
+        {
+            if (has_value())
+                return std::expected<value_type, error_type>(std::in_place, std::move(m_value));
+
+            return std::expected<value_type, error_type>(std::unexpect, *std::move(m_error));
+        }
+
+        std::optional<value_type> to_optional() const&
+        {
+            if (has_value())
+                return std::optional<value_type>(std::in_place, m_value);
+
+            return std::nullopt;
+        }
+
+        std::optional<value_type> to_optional() &&
+        {
+            if (has_value())
+                return std::optional<value_type>(std::in_place, std::move(m_value));
+
+            return std::nullopt;
+        }
+
+        //Exception boundary: returns the value or throws bad_result_access<Err> holding the error.
+        //Requires <result/exception.hpp>.
+        value_type& value_or_throw() &
+        {
+            if (!has_value())
+                throw bad_result_access<error_type>(*m_error);
+
+            return m_value;
+        }
+
+        const value_type& value_or_throw() const&
+        {
+            if (!has_value())
+                throw bad_result_access<error_type>(*m_error);
+
+            return m_value;
+        }
+
+        value_type&& value_or_throw() &&
+        {
+            if (!has_value())
+                throw bad_result_access<error_type>(*std::move(m_error));
+
+            return std::move(m_value);
+        }
+
+        //Throws whatever to_exception(error) returns instead of bad_result_access.
+        template <class F>
+            requires std::invocable<F, const error_type&>
+        value_type& value_or_throw(F&& to_exception) &
+        {
+            if (!has_value())
+                throw std::invoke(std::forward<F>(to_exception), std::as_const(*m_error));
+
+            return m_value;
+        }
+
+        template <class F>
+            requires std::invocable<F, const error_type&>
+        const value_type& value_or_throw(F&& to_exception) const&
+        {
+            if (!has_value())
+                throw std::invoke(std::forward<F>(to_exception), *m_error);
+
+            return m_value;
+        }
+
+        template <class F>
+            requires std::invocable<F, error_type&&>
+        value_type&& value_or_throw(F&& to_exception) &&
+        {
+            if (!has_value())
+                throw std::invoke(std::forward<F>(to_exception), *std::move(m_error));
+
+            return std::move(m_value);
+        }
+
         const value_type* operator->() const
         {
             return &m_value;
@@ -338,10 +556,77 @@ namespace xt
             if constexpr (index == 1) return std::move(m_error);
         }
 
+        //Comparison
+        //Results holding a value compare by value, results holding an error compare by error
+        //and any result holding a value orders before any result holding an error.
+        //Only the public interface of rhs is used, friendship does not extend to other specializations.
+        template <class UTy, class UErr>
+            requires (std::equality_comparable_with<Ty, UTy> &&
+                      std::equality_comparable_with<Err, UErr>)
+        friend constexpr bool operator==(const result& lhs, const result<UTy, UErr>& rhs)
+        {
+            if (lhs.has_value() != rhs.has_value())
+                return false;
+
+            if (lhs.has_value())
+                return *lhs == *rhs;
+
+            return *lhs.template get<1>() == *rhs.template get<1>();
+        }
+
+        template <class UTy, class UErr>
+            requires (std::three_way_comparable_with<Ty, UTy> &&
+                      std::three_way_comparable_with<Err, UErr>)
+        friend constexpr std::common_comparison_category_t<std::compare_three_way_result_t<Ty, UTy>, std::compare_three_way_result_t<Err, UErr>>
+            operator<=>(const result& lhs, const result<UTy, UErr>& rhs)
+        {
+            if (lhs.has_value() != rhs.has_value())
+                return rhs.has_value() <=> lhs.has_value();
+
+            if (lhs.has_value())
+                return *lhs <=> *rhs;
+
+            return *lhs.template get<1>() <=> *rhs.template get<1>();
+        }
+
     private:
         value_type m_value;
         error<error_type> m_error;
     };
+
+    namespace detail
+    {
+        constexpr std::size_t hash_combine(std::size_t seed, std::size_t hash) noexcept
+        {
+            return seed ^ (hash + static_cast<std::size_t>(0x9e3779b97f4a7c15ull) + (seed << 6) + (seed >> 2));
+        }
+
+        template <typename T>
+        concept hashable = requires(const T& value)
+        {
+            { std::hash<T>{}(value) } -> std::convertible_to<std::size_t>;
+        };
+
+        template <typename T>
+        struct is_result : std::false_type
+        {
+        };
+
+        template <typename T, typename E>
+        struct is_result<result<T, E>> : std::true_type
+        {
+        };
+
+        template <typename T>
+        struct is_error : std::false_type
+        {
+        };
+
+        template <typename E>
+        struct is_error<error<E>> : std::true_type
+        {
+        };
+    }  // namespace detail
 }  // namespace xt
 
 namespace std
@@ -362,4 +647,30 @@ namespace std
     {
         using type = xt::error<E>;
     };
-}
\ No newline at end of file
+
+    template <typename E>
+        requires xt::detail::hashable<E>
+    struct hash<xt::error<E>>
+    {
+        size_t operator()(const xt::error<E>& err) const
+        {
+            if (!err)
+                return 0;
+
+            return xt::detail::hash_combine(1, hash<E>{}(*err));
+        }
+    };
+
+    template <typename T, typename E>
+        requires (xt::detail::hashable<T> && xt::detail::hashable<E>)
+    struct hash<xt::result<T, E>>
+    {
+        size_t operator()(const xt::result<T, E>& res) const
+        {
+            if (res.has_value())
+                return hash<T>{}(*res);
+
+            return hash<xt::error<E>>{}(res.template get<1>());
+        }
+    };
+}
@@ -0,0 +1,220 @@
+#pragma once
+#include "result.hpp"
+#include <atomic>
+#include <cstddef>
+#include <compare>
+#include <utility>
+#include <concepts>
+#include <functional>
+#include <type_traits>
+
+namespace xt
+{
+    //Reference count shared between threads, the default policy of shared_error.
+    struct atomic_refcount
+    {
+        using counter_type = std::atomic<std::size_t>;
+
+        static void increment(counter_type& count) noexcept
+        {
+            count.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        //True when the last reference was released.
+        static bool decrement(counter_type& count) noexcept
+        {
+            return count.fetch_sub(1, std::memory_order_acq_rel) == 1;
+        }
+
+        static std::size_t load(const counter_type& count) noexcept
+        {
+            return count.load(std::memory_order_relaxed);
+        }
+    };
+
+    //Plain reference count for errors that never leave the thread that created them.
+    struct local_refcount
+    {
+        using counter_type = std::size_t;
+
+        static void increment(counter_type& count) noexcept
+        {
+            ++count;
+        }
+
+        static bool decrement(counter_type& count) noexcept
+        {
+            return --count == 0;
+        }
+
+        static std::size_t load(const counter_type& count) noexcept
+        {
+            return count;
+        }
+    };
+
+    //Immutable, reference counted error payload. Copying is a single increment, so one failure
+    //can be handed to any number of callers without copying E.
+    //The payload is never modified after creation, so with atomic_refcount copies may be read and
+    //destroyed on any thread. A single shared_error object is not safe to assign concurrently.
+    //The default constructed shared_error is empty and means "no error", so does a moved-from one.
+    //Wrapping an empty shared_error in an engaged xt::error throws std::invalid_argument.
+    template <typename E, typename Policy = atomic_refcount>
+    class shared_error
+    {
+        struct control
+        {
+            template <class... Args>
+            explicit control(Args&&... values)
+                : payload(std::forward<Args>(values)...)
+            {
+
+            }
+
+            typename Policy::counter_type count{ 1 };
+            const E payload;
+        };
+
+    public:
+        using element_type = E;
+        using policy_type = Policy;
+
+        constexpr shared_error() noexcept = default;
+
+        template <class UErr = E>
+            requires(!std::is_same_v<std::remove_cvref_t<UErr>, shared_error> &&
+                     !std::is_same_v<std::remove_cvref_t<UErr>, std::in_place_t> &&
+                      std::constructible_from<E, UErr>)
+        explicit(!std::is_convertible_v<UErr, E>) shared_error(UErr&& err)
+            : m_control(new control(std::forward<UErr>(err)))
+        {
+
+        }
+
+        template <class... Args>
+            requires(std::constructible_from<E, Args...>)
+        explicit shared_error(std::in_place_t, Args&&... values)
+            : m_control(new control(std::forward<Args>(values)...))
+        {
+
+        }
+
+        shared_error(const shared_error& other) noexcept
+            : m_control(other.m_control)
+        {
+            if (m_control)
+                Policy::increment(m_control->count);
+        }
+
+        shared_error(shared_error&& other) noexcept
+            : m_control(std::exchange(other.m_control, nullptr))
+        {
+
+        }
+
+        shared_error& operator=(const shared_error& other) noexcept
+        {
+            shared_error(other).swap(*this);
+            return *this;
+        }
+
+        shared_error& operator=(shared_error&& other) noexcept
+        {
+            shared_error(std::move(other)).swap(*this);
+            return *this;
+        }
+
+        ~shared_error()
+        {
+            if (m_control && Policy::decrement(m_control->count))
+                delete m_control;
+        }
+
+        void swap(shared_error& other) noexcept
+        {
+            std::swap(m_control, other.m_control);
+        }
+
+        explicit operator bool() const noexcept
+        {
+            return m_control != nullptr;
+        }
+
+        //Null when empty.
+        const E* get() const noexcept
+        {
+            return m_control ? &m_control->payload : nullptr;
+        }
+
+        const E& operator*() const noexcept
+        {
+            return m_control->payload;
+        }
+
+        const E* operator->() const noexcept
+        {
+            return &m_control->payload;
+        }
+
+        //Number of shared_error objects referring to the payload, zero when empty.
+        std::size_t use_count() const noexcept
+        {
+            return m_control ? Policy::load(m_control->count) : 0;
+        }
+
+        //Comparison
+        //Errors sharing a payload compare equal without looking at it. An empty error orders before any other.
+        friend bool operator==(const shared_error& lhs, const shared_error& rhs)
+            requires std::equality_comparable<E>
+        {
+            if (lhs.m_control == rhs.m_control)
+                return true;
+
+            return lhs && rhs && *lhs == *rhs;
+        }
+
+        template <typename UErr = E>
+            requires std::three_way_comparable<UErr>
+        friend std::compare_three_way_result_t<UErr> operator<=>(const shared_error& lhs, const shared_error& rhs)
+        {
+            if (lhs && rhs)
+                return *lhs <=> *rhs;
+
+            return static_cast<bool>(lhs) <=> static_cast<bool>(rhs);
+        }
+
+    private:
+        control* m_control = nullptr;
+    };
+
+    template <typename E, typename Policy = atomic_refcount, class... Args>
+        requires(std::constructible_from<E, Args...>)
+    shared_error<E, Policy> make_shared_error(Args&&... values)
+    {
+        return shared_error<E, Policy>(std::in_place, std::forward<Args>(values)...);
+    }
+
+    template <typename E, typename Policy>
+    struct error_traits<shared_error<E, Policy>>
+    {
+        static constexpr bool has_empty_state = true;
+
+        static constexpr bool is_empty(const shared_error<E, Policy>& err) noexcept
+        {
+            return !err;
+        }
+    };
+}  // namespace xt
+
+namespace std
+{
+    template <typename E, typename Policy>
+        requires xt::detail::hashable<E>
+    struct hash<xt::shared_error<E, Policy>>
+    {
+        size_t operator()(const xt::shared_error<E, Policy>& err) const
+        {
+            return err ? hash<E>{ }(*err) : 0;
+        }
+    };
+}
@@ -0,0 +1,343 @@
+#pragma once
+#include "result.hpp"
+#include <array>
+#include <atomic>
+#include <memory>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <optional>
+#include <concepts>
+#include <stdexcept>
+#include <type_traits>
+
+namespace xt
+{
+    //Number of errors per thread and error type that can be parked at once. Parking another one while all
+    //slots are taken evicts the error in the slot at the cursor, reading an evicted error throws.
+    inline constexpr std::size_t slim_error_capacity = 64;
+
+    namespace detail
+    {
+        //Per-thread table of parked errors, addressed by a ticket handed out when the error is parked.
+        //A ticket selects its slot by its low bits, the slot keeps the ticket of the error it holds.
+        //Tickets are drawn in blocks from a counter shared by all threads, so a ticket is never valid on
+        //another thread and a stale ticket never observes a later error until 2^32 errors of the type were parked.
+        template <typename Err>
+        class parked_errors
+        {
+        public:
+            using ticket_type = std::uint32_t;
+
+            static parked_errors& local()
+            {
+                thread_local parked_errors errors{ };
+                return errors;
+            }
+
+            //Skips slots that still hold an error, unless all of them do.
+            template <class... Args>
+            ticket_type park(Args&&... values)
+            {
+                ticket_type ticket = next_ticket();
+                if (m_parked == slim_error_capacity)
+                {
+                    slot_at(ticket).error.reset();
+                    --m_parked;
+                }
+                else
+                {
+                    while (slot_at(ticket).error)
+                        ticket = next_ticket();
+                }
+
+                slot& target = slot_at(ticket);
+                target.error.emplace(std::forward<Args>(values)...);
+                target.ticket = ticket;
+                ++m_parked;
+                return ticket;
+            }
+
+            Err* find(ticket_type ticket) noexcept
+            {
+                slot& target = slot_at(ticket);
+                if (!target.error || target.ticket != ticket)
+                    return nullptr;
+
+                return std::addressof(*target.error);
+            }
+
+            //The ticket must name a parked error, as checked by find().
+            void release(ticket_type ticket) noexcept
+            {
+                slot_at(ticket).error.reset();
+                --m_parked;
+            }
+
+        private:
+            static_assert(std::has_single_bit(slim_error_capacity));
+
+            //Tickets each thread takes from the shared counter at once, a multiple of the slot count so
+            //consecutive tickets keep walking the slots in order across blocks.
+            static constexpr ticket_type block_size = 4096;
+
+            struct slot
+            {
+                ticket_type ticket = 0;
+                std::optional<Err> error;
+            };
+
+            parked_errors() = default;
+
+            static std::atomic<ticket_type>& blocks() noexcept
+            {
+                static std::atomic<ticket_type> next{ 0 };
+                return next;
+            }
+
+            slot& slot_at(ticket_type ticket) noexcept
+            {
+                return m_slots[ticket & (slim_error_capacity - 1)];
+            }
+
+            ticket_type next_ticket() noexcept
+            {
+                if (m_next == m_block_end)
+                {
+                    m_next = blocks().fetch_add(block_size, std::memory_order_relaxed);
+                    m_block_end = m_next + block_size;
+                }
+                return m_next++;
+            }
+
+            std::array<slot, slim_error_capacity> m_slots{ };
+            std::size_t m_parked = 0;
+            ticket_type m_next = 0;
+            ticket_type m_block_end = 0;
+        };
+    }  // namespace detail
+
+    //A result that only carries the value, or a 32-bit ticket in its place, and a flag. The error is parked out
+    //of band in a per-thread slot. It is trivially copyable whenever Ty is, so it is returned in registers on
+    //common ABIs. A failed slim_result must be consumed on the thread that created it; copies share the
+    //same parked error. A failure dropped without take_error() or to_result() && keeps its slot until
+    //slim_error_capacity errors are parked at once and it is evicted.
+    template <typename Ty, typename Err>
+    class slim_result
+    {
+        using value_type = Ty;
+        using error_type = Err;
+        using ticket_type = typename detail::parked_errors<Err>::ticket_type;
+
+    public:
+        //Result-Start
+        template <typename UTy = Ty>
+            requires (!std::is_same_v<std::remove_cvref_t<UTy>, slim_result> &&
+                      !std::is_same_v<std::remove_cvref_t<UTy>, std::in_place_t> &&
+                      !detail::is_result<std::remove_cvref_t<UTy>>::value &&
+                      !detail::is_error<std::remove_cvref_t<UTy>>::value &&
+                       std::constructible_from<Ty, UTy>)
+        constexpr explicit(!std::is_convertible_v<UTy, Ty>) slim_result(UTy&& value) noexcept(std::is_nothrow_constructible_v<Ty, UTy>)
+            : m_value(std::forward<UTy>(value)), m_has_value(true)
+        {
+
+        }
+
+        template <class... Args>
+            requires(std::constructible_from<Ty, Args...>)
+        constexpr explicit slim_result(std::in_place_t, Args&&... values)
+            : m_value(std::forward<Args>(values)...), m_has_value(true)
+        {
+
+        }
+        //Result-End
+
+        //Error-Start
+        template <class UErr>
+            requires (std::constructible_from<Err, const UErr&>)
+        explicit(!std::is_convertible_v<const UErr&, Err>) slim_result(const error<UErr>& err)
+            : m_ticket(detail::parked_errors<Err>::local().park(*err)), m_has_value(false)
+        {
+
+        }
+
+        template <class UErr>
+            requires (std::constructible_from<Err, UErr>)
+        explicit(!std::is_convertible_v<UErr, Err>) slim_result(error<UErr>&& err)
+            : m_ticket(detail::parked_errors<Err>::local().park(*std::move(err))), m_has_value(false)
+        {
+
+        }
+        //Error-End
+
+        slim_result(const slim_result&) requires std::is_trivially_copy_constructible_v<Ty> = default;
+
+        slim_result(const slim_result& other) noexcept(std::is_nothrow_copy_constructible_v<Ty>)
+            : m_has_value(other.m_has_value)
+        {
+            if (m_has_value)
+                std::construct_at(std::addressof(m_value), other.m_value);
+            else
+                std::construct_at(std::addressof(m_ticket), other.m_ticket);
+        }
+
+        slim_result(slim_result&&) requires std::is_trivially_move_constructible_v<Ty> = default;
+
+        slim_result(slim_result&& other) noexcept(std::is_nothrow_move_constructible_v<Ty>)
+            : m_has_value(other.m_has_value)
+        {
+            if (m_has_value)
+                std::construct_at(std::addressof(m_value), std::move(other.m_value));
+            else
+                std::construct_at(std::addressof(m_ticket), other.m_ticket);
+        }
+
+        slim_result& operator=(const slim_result&) requires std::is_trivially_copyable_v<Ty> = default;
+
+        slim_result& operator=(slim_result&&) requires std::is_trivially_copyable_v<Ty> = default;
+
+        slim_result& operator=(const slim_result& other)
+            requires (!std::is_trivially_copyable_v<Ty> && std::is_copy_constructible_v<Ty> && std::is_copy_assignable_v<Ty>)
+        {
+            assign(other);
+            return *this;
+        }
+
+        slim_result& operator=(slim_result&& other) noexcept(std::is_nothrow_move_constructible_v<Ty> && std::is_nothrow_move_assignable_v<Ty>)
+            requires (!std::is_trivially_copyable_v<Ty> && std::is_move_constructible_v<Ty> && std::is_move_assignable_v<Ty>)
+        {
+            assign(std::move(other));
+            return *this;
+        }
+
+        ~slim_result() requires std::is_trivially_destructible_v<Ty> = default;
+
+        ~slim_result()
+        {
+            if (m_has_value)
+                std::destroy_at(std::addressof(m_value));
+        }
+
+        operator bool() const
+        {
+            return m_has_value;
+        }
+
+        bool has_value() const
+        {
+            return m_has_value;
+        }
+
+        //The parked error, valid until it is consumed.
+        //Throws std::logic_error when there is none: the result holds a value, the error was already
+        //consumed or evicted, or it was parked on another thread.
+        const error_type& get_error() const
+        {
+            return *parked_error(detail::parked_errors<Err>::local());
+        }
+
+        //Moves the parked error out and frees its slot. Throws like get_error().
+        error_type take_error() &&
+        {
+            auto& parked = detail::parked_errors<Err>::local();
+            error_type taken(std::move(*parked_error(parked)));
+            parked.release(m_ticket);
+            return taken;
+        }
+
+        //Copies the parked error into a full result, leaving it parked.
+        result<value_type, error_type> to_result() const&
+        {
+            if (m_has_value)
+                return result<value_type, error_type>(std::in_place, m_value);
+
+            return result<value_type, error_type>(error<error_type>(std::in_place, get_error()));
+        }
+
+        //Moves the value or the parked error into a full result and frees the parked slot.
+        result<value_type, error_type> to_result() &&
+        {
+            if (m_has_value)
+                return result<value_type, error_type>(std::in_place, std::move(m_value));
+
+            return result<value_type, error_type>(error<error_type>(std::in_place, std::move(*this).take_error()));
+        }
+
+        const value_type* operator->() const
+        {
+            return std::addressof(m_value);
+        }
+
+        value_type* operator->()
+        {
+            return std::addressof(m_value);
+        }
+
+        value_type& operator*()&
+        {
+            return m_value;
+        }
+
+        const value_type& operator*() const&
+        {
+            return m_value;
+        }
+
+        value_type&& operator*()&&
+        {
+            return std::move(m_value);
+        }
+
+    private:
+        template <class Other>
+        void assign(Other&& other)
+        {
+            if (m_has_value && other.m_has_value)
+            {
+                m_value = std::forward<Other>(other).m_value;
+            }
+            else if (m_has_value)
+            {
+                std::destroy_at(std::addressof(m_value));
+                std::construct_at(std::addressof(m_ticket), other.m_ticket);
+                m_has_value = false;
+            }
+            else if (other.m_has_value)
+            {
+                //Keeps the ticket when constructing the value throws.
+                const ticket_type ticket = m_ticket;
+                try
+                {
+                    std::construct_at(std::addressof(m_value), std::forward<Other>(other).m_value);
+                }
+                catch (...)
+                {
+                    std::construct_at(std::addressof(m_ticket), ticket);
+                    throw;
+                }
+                m_has_value = true;
+            }
+            else
+            {
+                m_ticket = other.m_ticket;
+            }
+        }
+
+        Err* parked_error(detail::parked_errors<Err>& errors) const
+        {
+            Err* parked = m_has_value ? nullptr : errors.find(m_ticket);
+            if (!parked)
+                throw std::logic_error("xt::slim_result has no parked error: it holds a value, was consumed or evicted, or belongs to another thread");
+
+            return parked;
+        }
+
+        union
+        {
+            value_type m_value;
+            ticket_type m_ticket;
+        };
+        bool m_has_value;
+    };
+}  // namespace xt
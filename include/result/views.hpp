@@ -0,0 +1,424 @@
+#pragma once
+#include "result.hpp"
+#include <ranges>
+#include <utility>
+#include <optional>
+#include <iterator>
+#include <concepts>
+#include <functional>
+#include <type_traits>
+
+namespace xt::detail
+{
+    template <typename R>
+    concept result_range = std::ranges::input_range<R> &&
+                           is_result<std::remove_cvref_t<std::ranges::range_reference_t<R>>>::value;
+
+    template <bool Const, typename T>
+    using maybe_const = std::conditional_t<Const, const T, T>;
+
+    //Projects a result onto its value or its error payload without copying either.
+    template <bool Errors, typename Res>
+    constexpr decltype(auto) project_result(Res&& res)
+    {
+        if constexpr (Errors)
+            return *(std::forward<Res>(res).template get<1>());
+        else
+            return *std::forward<Res>(res);
+    }
+
+    //References into the underlying results are passed through, prvalue results are projected by value.
+    template <bool Errors, typename Ref>
+    using projected_t = std::conditional_t<std::is_reference_v<Ref>,
+                                           decltype(project_result<Errors>(std::declval<Ref>())),
+                                           std::remove_cvref_t<decltype(project_result<Errors>(std::declval<Ref>()))>>;
+
+    //Caches a begin iterator, copies and moves of the owning view start out empty so no iterator
+    //into another view's base is ever reused.
+    template <typename T>
+    class begin_cache
+    {
+    public:
+        begin_cache() = default;
+
+        constexpr begin_cache(const begin_cache&) noexcept
+        {
+
+        }
+
+        constexpr begin_cache(begin_cache&& other) noexcept
+        {
+            other.m_value.reset();
+        }
+
+        constexpr begin_cache& operator=(const begin_cache& other) noexcept
+        {
+            if (this != &other)
+                m_value.reset();
+
+            return *this;
+        }
+
+        constexpr begin_cache& operator=(begin_cache&& other) noexcept
+        {
+            m_value.reset();
+            other.m_value.reset();
+            return *this;
+        }
+
+        template <typename F>
+        constexpr T& get_or_emplace(F&& make)
+        {
+            if (!m_value)
+                m_value.emplace(std::forward<F>(make)());
+
+            return *m_value;
+        }
+
+    private:
+        std::optional<T> m_value{ };
+    };
+
+    struct no_begin_cache
+    {
+    };
+
+    template <typename Derived>
+    struct pipeable
+    {
+        template <std::ranges::viewable_range R>
+            requires std::invocable<const Derived&, R>
+        friend constexpr auto operator|(R&& range, const Derived& adaptor)
+        {
+            return adaptor(std::forward<R>(range));
+        }
+    };
+}  // namespace xt::detail
+
+namespace xt::ranges
+{
+    //Yields the values (Errors == false) or the errors (Errors == true) of a range of results.
+    //Like std::ranges::filter_view, begin() of a forward range is cached after the first call so it stays
+    //amortized O(1). The view is therefore never borrowed and cannot be iterated through a const reference.
+    template <std::ranges::view V, bool Errors>
+        requires detail::result_range<V>
+    class result_projection_view : public std::ranges::view_interface<result_projection_view<V, Errors>>
+    {
+        class iterator
+        {
+            using parent = V;
+            using base_iterator = std::ranges::iterator_t<parent>;
+            using base_sentinel = std::ranges::sentinel_t<parent>;
+
+        public:
+            using reference = detail::projected_t<Errors, std::ranges::range_reference_t<parent>>;
+            using value_type = std::remove_cvref_t<reference>;
+            using difference_type = std::ranges::range_difference_t<parent>;
+            using iterator_concept = std::conditional_t<std::ranges::bidirectional_range<parent>, std::bidirectional_iterator_tag,
+                                     std::conditional_t<std::ranges::forward_range<parent>, std::forward_iterator_tag, std::input_iterator_tag>>;
+            using iterator_category = std::conditional_t<std::is_lvalue_reference_v<reference>, iterator_concept, std::input_iterator_tag>;
+
+            iterator() requires std::default_initializable<base_iterator> = default;
+
+            constexpr iterator(base_iterator current, base_sentinel end)
+                : m_current(std::move(current)), m_end(std::move(end))
+            {
+                satisfy();
+            }
+
+            constexpr const base_iterator& base() const& noexcept
+            {
+                return m_current;
+            }
+
+            constexpr reference operator*() const
+            {
+                return static_cast<reference>(detail::project_result<Errors>(*m_current));
+            }
+
+            //The common case of the next element matching stays straight-line, so a loop over the view
+            //compiles to the same single-branch body as the equivalent hand-written loop.
+            constexpr iterator& operator++()
+            {
+                ++m_current;
+                if (m_current != m_end && !matches(*m_current)) [[unlikely]]
+                    skip();
+                return *this;
+            }
+
+            constexpr void operator++(int)
+            {
+                ++*this;
+            }
+
+            constexpr iterator operator++(int) requires std::ranges::forward_range<parent>
+            {
+                auto copy = *this;
+                ++*this;
+                return copy;
+            }
+
+            constexpr iterator& operator--() requires std::ranges::bidirectional_range<parent>
+            {
+                do
+                {
+                    --m_current;
+                } while (!matches(*m_current));
+                return *this;
+            }
+
+            constexpr iterator operator--(int) requires std::ranges::bidirectional_range<parent>
+            {
+                auto copy = *this;
+                --*this;
+                return copy;
+            }
+
+            friend constexpr bool operator==(const iterator& lhs, const iterator& rhs)
+                requires std::equality_comparable<base_iterator>
+            {
+                return lhs.m_current == rhs.m_current;
+            }
+
+            friend constexpr bool operator==(const iterator& it, std::default_sentinel_t)
+            {
+                return it.m_current == it.m_end;
+            }
+
+        private:
+            template <typename Res>
+            static constexpr bool matches(Res&& res)
+            {
+                return res.has_value() != Errors;
+            }
+
+            constexpr void skip()
+            {
+                do
+                {
+                    ++m_current;
+                } while (m_current != m_end && !matches(*m_current));
+            }
+
+            constexpr void satisfy()
+            {
+                while (m_current != m_end && !matches(*m_current))
+                    ++m_current;
+            }
+
+            base_iterator m_current{ };
+            base_sentinel m_end{ };
+        };
+
+    public:
+        result_projection_view() requires std::default_initializable<V> = default;
+
+        constexpr explicit result_projection_view(V base)
+            : m_base(std::move(base))
+        {
+
+        }
+
+        constexpr V base() const& requires std::copy_constructible<V>
+        {
+            return m_base;
+        }
+
+        constexpr V base() &&
+        {
+            return std::move(m_base);
+        }
+
+        constexpr iterator begin()
+        {
+            const auto first = [this] { return iterator{ std::ranges::begin(m_base), std::ranges::end(m_base) }; };
+            if constexpr (std::ranges::forward_range<V>)
+                return m_begin.get_or_emplace(first);
+            else
+                return first();
+        }
+
+        constexpr auto end()
+        {
+            if constexpr (std::ranges::common_range<V> && std::ranges::forward_range<V>)
+                return iterator{ std::ranges::end(m_base), std::ranges::end(m_base) };
+            else
+                return std::default_sentinel;
+        }
+
+    private:
+        V m_base = V();
+        XT_NO_UNIQUE_ADDRESS std::conditional_t<std::ranges::forward_range<V>, detail::begin_cache<iterator>, detail::no_begin_cache> m_begin{ };
+    };
+
+    template <std::ranges::view V>
+    using values_view = result_projection_view<V, false>;
+
+    template <std::ranges::view V>
+    using errors_view = result_projection_view<V, true>;
+
+    //Yields the leading results of a range up to, but not including, the first error.
+    //The underlying iterator is used as-is, so contiguous and random access ranges stay that way.
+    template <std::ranges::view V>
+        requires detail::result_range<V>
+    class take_until_error_view : public std::ranges::view_interface<take_until_error_view<V>>
+    {
+        template <bool Const>
+        class sentinel
+        {
+            using parent = detail::maybe_const<Const, V>;
+            using base_sentinel = std::ranges::sentinel_t<parent>;
+
+        public:
+            sentinel() = default;
+
+            constexpr explicit sentinel(base_sentinel end)
+                : m_end(std::move(end))
+            {
+
+            }
+
+            constexpr base_sentinel base() const
+            {
+                return m_end;
+            }
+
+            friend constexpr bool operator==(const std::ranges::iterator_t<parent>& it, const sentinel& end)
+            {
+                return it == end.m_end || !(*it).has_value();
+            }
+
+        private:
+            base_sentinel m_end{ };
+        };
+
+    public:
+        take_until_error_view() requires std::default_initializable<V> = default;
+
+        constexpr explicit take_until_error_view(V base)
+            : m_base(std::move(base))
+        {
+
+        }
+
+        constexpr V base() const& requires std::copy_constructible<V>
+        {
+            return m_base;
+        }
+
+        constexpr V base() &&
+        {
+            return std::move(m_base);
+        }
+
+        constexpr auto begin()
+        {
+            return std::ranges::begin(m_base);
+        }
+
+        constexpr auto begin() const requires detail::result_range<const V>
+        {
+            return std::ranges::begin(m_base);
+        }
+
+        constexpr auto end()
+        {
+            return sentinel<false>{ std::ranges::end(m_base) };
+        }
+
+        constexpr auto end() const requires detail::result_range<const V>
+        {
+            return sentinel<true>{ std::ranges::end(m_base) };
+        }
+
+    private:
+        V m_base = V();
+    };
+}  // namespace xt::ranges
+
+namespace std::ranges
+{
+    template <typename V>
+    inline constexpr bool enable_borrowed_range<xt::ranges::take_until_error_view<V>> = enable_borrowed_range<V>;
+}
+
+namespace xt::detail
+{
+    //Maps the value of every successful result and forwards errors untouched.
+    template <typename F>
+    struct ok_transformer
+    {
+        F fn;
+
+        template <typename Res>
+        constexpr auto operator()(Res&& res) const
+        {
+            using value_type = std::remove_cvref_t<std::invoke_result_t<const F&, decltype(project_result<false>(std::forward<Res>(res)))>>;
+            using error_type = std::remove_cvref_t<decltype(project_result<true>(std::forward<Res>(res)))>;
+            using result_type = result<value_type, error_type>;
+
+            if (res.has_value())
+                return result_type(std::in_place, std::invoke(fn, project_result<false>(std::forward<Res>(res))));
+
+            return result_type(error<error_type>(std::in_place, project_result<true>(std::forward<Res>(res))));
+        }
+    };
+
+    template <bool Errors>
+    struct projection_fn : pipeable<projection_fn<Errors>>
+    {
+        template <std::ranges::viewable_range R>
+            requires result_range<std::views::all_t<R>>
+        constexpr auto operator()(R&& range) const
+        {
+            return ranges::result_projection_view<std::views::all_t<R>, Errors>(std::views::all(std::forward<R>(range)));
+        }
+    };
+
+    struct take_until_error_fn : pipeable<take_until_error_fn>
+    {
+        template <std::ranges::viewable_range R>
+            requires result_range<std::views::all_t<R>>
+        constexpr auto operator()(R&& range) const
+        {
+            return ranges::take_until_error_view<std::views::all_t<R>>(std::views::all(std::forward<R>(range)));
+        }
+    };
+
+    template <typename F>
+    struct transform_ok_closure : pipeable<transform_ok_closure<F>>
+    {
+        F fn;
+
+        template <std::ranges::viewable_range R>
+            requires result_range<std::views::all_t<R>>
+        constexpr auto operator()(R&& range) const
+        {
+            return std::views::transform(std::forward<R>(range), ok_transformer<F>{ fn });
+        }
+    };
+
+    struct transform_ok_fn
+    {
+        template <std::ranges::viewable_range R, typename F>
+            requires result_range<std::views::all_t<R>>
+        constexpr auto operator()(R&& range, F&& fn) const
+        {
+            return std::views::transform(std::forward<R>(range), ok_transformer<std::decay_t<F>>{ std::forward<F>(fn) });
+        }
+
+        template <typename F>
+        constexpr auto operator()(F&& fn) const
+        {
+            return transform_ok_closure<std::decay_t<F>>{ { }, std::forward<F>(fn) };
+        }
+    };
+}  // namespace xt::detail
+
+namespace xt::views
+{
+    inline constexpr detail::projection_fn<false> values{ };
+    inline constexpr detail::projection_fn<true> errors{ };
+    inline constexpr detail::take_until_error_fn take_until_error{ };
+    inline constexpr detail::transform_ok_fn transform_ok{ };
+}  // namespace xt::views
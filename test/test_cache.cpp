@@ -0,0 +1,206 @@
+#include <result/cache.hpp>
+#include <atomic>
+#include <chrono>
+#include <latch>
+#include <string>
+#include <thread>
+#include <vector>
+#include <stdexcept>
+#include <gtest/gtest.h>
+
+namespace
+{
+    using cache_type = xt::result_cache<int, std::string, std::string>;
+
+    xt::result<std::string, std::string> lookup(int key)
+    {
+        if (key < 0)
+            return xt::error<std::string>{ "negative" };
+
+        return std::to_string(key);
+    }
+}
+
+TEST(cache, ComputesOnMiss)
+{
+    cache_type cache{ };
+    int calls = 0;
+    const auto handle = cache.get_or_compute(7, [&](int key) { ++calls; return lookup(key); });
+    ASSERT_TRUE(handle);
+    EXPECT_EQ(**handle, "7");
+    EXPECT_EQ(calls, 1);
+}
+
+TEST(cache, HitSharesHandle)
+{
+    cache_type cache{ };
+    int calls = 0;
+    const auto first = cache.get_or_compute(7, [&](int key) { ++calls; return lookup(key); });
+    const auto second = cache.get_or_compute(7, [&](int key) { ++calls; return lookup(key); });
+    EXPECT_EQ(calls, 1);
+    EXPECT_EQ(first.get(), second.get());
+    EXPECT_EQ(cache.find(7).get(), first.get());
+}
+
+TEST(cache, ErrorsNotCachedByDefault)
+{
+    cache_type cache{ };
+    int calls = 0;
+    const auto first = cache.get_or_compute(-1, [&](int key) { ++calls; return lookup(key); });
+    const auto second = cache.get_or_compute(-1, [&](int key) { ++calls; return lookup(key); });
+    EXPECT_FALSE(first->has_value());
+    EXPECT_EQ(second->get_error(), "negative");
+    EXPECT_EQ(calls, 2);
+    EXPECT_FALSE(cache.find(-1));
+}
+
+TEST(cache, NegativeCaching)
+{
+    cache_type cache{ { .error_ttl = std::chrono::minutes(1) } };
+    int calls = 0;
+    cache.get_or_compute(-1, [&](int key) { ++calls; return lookup(key); });
+    const auto cached = cache.get_or_compute(-1, [&](int key) { ++calls; return lookup(key); });
+    EXPECT_EQ(calls, 1);
+    EXPECT_EQ(cached->get_error(), "negative");
+}
+
+TEST(cache, EntriesExpire)
+{
+    cache_type cache{ { .value_ttl = std::chrono::milliseconds(10) } };
+    int calls = 0;
+    cache.get_or_compute(1, [&](int key) { ++calls; return lookup(key); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    EXPECT_FALSE(cache.find(1));
+    cache.get_or_compute(1, [&](int key) { ++calls; return lookup(key); });
+    EXPECT_EQ(calls, 2);
+}
+
+TEST(cache, EraseAndClear)
+{
+    cache_type cache{ };
+    for (int key = 0; key < 100; ++key)
+        cache.get_or_compute(key, lookup);
+
+    EXPECT_EQ(cache.size(), 100u);
+    cache.erase(5);
+    EXPECT_FALSE(cache.find(5));
+    EXPECT_EQ(cache.size(), 99u);
+    cache.clear();
+    EXPECT_EQ(cache.size(), 0u);
+}
+
+TEST(cache, BoundedCapacity)
+{
+    cache_type cache{ { .shard_count = 4, .max_entries = 16 } };
+    EXPECT_EQ(cache.shard_count(), 4u);
+    for (int key = 0; key < 1000; ++key)
+        cache.get_or_compute(key, lookup);
+
+    EXPECT_LE(cache.size(), 16u);
+}
+
+TEST(cache, InsertDropsExpiredEntries)
+{
+    cache_type cache{ { .value_ttl = std::chrono::milliseconds(10), .shard_count = 1 } };
+    for (int key = 0; key < 1000; ++key)
+        cache.get_or_compute(key, lookup);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    cache.get_or_compute(1000, lookup);
+    EXPECT_EQ(cache.size(), 1u);
+}
+
+TEST(cache, FullShardEvictsExpiredBeforeLive)
+{
+    cache_type cache{ { .value_ttl = std::chrono::minutes(1), .error_ttl = std::chrono::milliseconds(10), .shard_count = 1, .max_entries = 4 } };
+    cache.get_or_compute(1, lookup);
+    cache.get_or_compute(-1, lookup);
+    cache.get_or_compute(-2, lookup);
+    cache.get_or_compute(2, lookup);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    cache.get_or_compute(3, lookup);
+    cache.get_or_compute(4, lookup);
+    EXPECT_EQ(cache.size(), 4u);
+    for (const int key : { 1, 2, 3, 4 })
+        EXPECT_TRUE(cache.find(key));
+}
+
+TEST(cache, FullShardEvictsEntryClosestToExpiring)
+{
+    cache_type cache{ { .value_ttl = std::chrono::minutes(1), .shard_count = 1, .max_entries = 2 } };
+    cache.get_or_compute(1, lookup);
+    cache.get_or_compute(2, lookup);
+    cache.get_or_compute(3, lookup);
+    EXPECT_FALSE(cache.find(1));
+    EXPECT_TRUE(cache.find(2));
+    EXPECT_TRUE(cache.find(3));
+}
+
+TEST(cache, ExceptionReachesCallerAndIsNotCached)
+{
+    cache_type cache{ };
+    EXPECT_THROW(cache.get_or_compute(1, [](int) -> xt::result<std::string, std::string> { throw std::runtime_error("boom"); }), std::runtime_error);
+    EXPECT_FALSE(cache.find(1));
+    EXPECT_EQ(**cache.get_or_compute(1, lookup), "1");
+}
+
+TEST(cache, SingleFlightCoalescesConcurrentMisses)
+{
+    constexpr int thread_count = 16;
+    cache_type cache{ };
+    std::atomic<int> calls{ 0 };
+    std::latch start{ thread_count };
+    std::vector<const xt::result<std::string, std::string>*> seen(thread_count);
+
+    std::vector<std::jthread> threads{ };
+    for (int i = 0; i < thread_count; ++i)
+    {
+        threads.emplace_back([&, i]
+        {
+            start.arrive_and_wait();
+            const auto handle = cache.get_or_compute(42, [&](int key)
+            {
+                ++calls;
+                std::this_thread::sleep_for(std::chrono::milliseconds(50));
+                return lookup(key);
+            });
+            seen[i] = handle.get();
+        });
+    }
+    threads.clear();
+
+    EXPECT_EQ(calls.load(), 1);
+    for (const auto* handle : seen)
+        EXPECT_EQ(handle, seen.front());
+}
+
+TEST(cache, StressMixedHitMissError)
+{
+    constexpr int thread_count = 8;
+    constexpr int key_count = 512;
+    cache_type cache{ { .error_ttl = std::chrono::minutes(1) } };
+    std::atomic<int> calls{ 0 };
+    std::atomic<int> mismatches{ 0 };
+
+    std::vector<std::jthread> threads{ };
+    for (int t = 0; t < thread_count; ++t)
+    {
+        threads.emplace_back([&, t]
+        {
+            for (int i = 0; i < 20'000; ++i)
+            {
+                const int key = (i * 7 + t * 13) % key_count - key_count / 4;
+                const auto handle = cache.get_or_compute(key, [&](int k) { ++calls; return lookup(k); });
+                const bool expected_value = key >= 0;
+                if (handle->has_value() != expected_value || (expected_value && **handle != std::to_string(key)))
+                    ++mismatches;
+            }
+        });
+    }
+    threads.clear();
+
+    EXPECT_EQ(mismatches.load(), 0);
+    EXPECT_EQ(calls.load(), key_count);
+    EXPECT_EQ(cache.size(), static_cast<std::size_t>(key_count));
+}
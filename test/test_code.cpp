@@ -0,0 +1,149 @@
+#include <result/code.hpp>
+#include <string>
+#include <stdexcept>
+#include <system_error>
+#include <gtest/gtest.h>
+
+namespace
+{
+    constexpr xt::code not_found = xt::make_code<"io", "file not found">();
+    constexpr xt::code denied = xt::make_code<"io", "permission denied">();
+
+    xt::result<int, xt::code> open_file(bool exists)
+    {
+        if (!exists)
+            return xt::error{ not_found };
+
+        return 3;
+    }
+}
+
+TEST(code, IsFourBytes)
+{
+    static_assert(sizeof(xt::code) == 4);
+    static_assert(sizeof(xt::error<xt::code>) == 4);
+    static_assert(sizeof(xt::result<int, xt::code>) == 8);
+    SUCCEED();
+}
+
+TEST(code, DefaultIsNoError)
+{
+    constexpr xt::code code{ };
+    static_assert(!code);
+    EXPECT_EQ(code.id(), 0u);
+    EXPECT_TRUE(code.message().empty());
+}
+
+TEST(code, CompileTimeIdentity)
+{
+    static_assert(not_found);
+    static_assert(not_found != denied);
+    static_assert(not_found == xt::make_code<"io", "file not found">());
+    static_assert(not_found.id() == xt::detail::hash_code("io", "file not found"));
+    SUCCEED();
+}
+
+TEST(code, CompileTimeCodeResolvesText)
+{
+    EXPECT_EQ(not_found.category(), "io");
+    EXPECT_EQ(not_found.message(), "file not found");
+    EXPECT_EQ(denied.message(), "permission denied");
+}
+
+TEST(code, CategoryIsPartOfIdentity)
+{
+    constexpr auto io = xt::make_code<"io", "timeout">();
+    constexpr auto net = xt::make_code<"net", "timeout">();
+    static_assert(io != net);
+    EXPECT_EQ(net.category(), "net");
+}
+
+TEST(code, RuntimeIntern)
+{
+    const std::string category{ "db" };
+    const std::string message{ "connection lost" };
+    const auto code = xt::code::intern(category, message);
+    EXPECT_TRUE(static_cast<bool>(code));
+    EXPECT_EQ(code, xt::code::intern("db", "connection lost"));
+    EXPECT_EQ(code.category(), "db");
+    EXPECT_EQ(code.message(), "connection lost");
+}
+
+TEST(code, RuntimeInternMatchesCompileTime)
+{
+    EXPECT_EQ(xt::code::intern("io", "file not found"), not_found);
+}
+
+TEST(code, UnregisteredCodeHasNoText)
+{
+    const xt::code unknown{ 0xdeadbeef };
+    EXPECT_TRUE(unknown.category().empty());
+    EXPECT_TRUE(unknown.message().empty());
+}
+
+TEST(code, UsableAsResultError)
+{
+    const auto failed = open_file(false);
+    EXPECT_FALSE(failed.has_value());
+    EXPECT_EQ(failed.get_error(), not_found);
+    EXPECT_EQ(failed.get_error().message(), "file not found");
+
+    const auto opened = open_file(true);
+    EXPECT_TRUE(opened.has_value());
+    EXPECT_EQ(*opened, 3);
+}
+
+TEST(code, ErrorEngagedFollowsCode)
+{
+    const xt::error<xt::code> empty{ };
+    const xt::error<xt::code> engaged{ denied };
+    EXPECT_FALSE(static_cast<bool>(empty));
+    EXPECT_TRUE(static_cast<bool>(engaged));
+    EXPECT_EQ(*engaged, denied);
+}
+
+TEST(code, EngagedErrorRejectsEmptyCode)
+{
+    EXPECT_THROW(static_cast<void>(xt::error<xt::code>{ xt::code{ } }), std::invalid_argument);
+    EXPECT_THROW(static_cast<void>(xt::error<xt::code>(std::in_place)), std::invalid_argument);
+    EXPECT_THROW(static_cast<void>(xt::error<xt::code>{ std::unexpected<xt::code>{ xt::code{ } } }), std::invalid_argument);
+    EXPECT_THROW((xt::result<int, xt::code>{ xt::error{ xt::code{ } } }), std::invalid_argument);
+
+    const xt::error<xt::code> empty{ };
+    const xt::error<xt::code> converted{ empty };
+    EXPECT_FALSE(static_cast<bool>(converted));
+}
+
+TEST(code, Hash)
+{
+    EXPECT_EQ(std::hash<xt::code>{ }(not_found), std::hash<xt::code>{ }(xt::code::intern("io", "file not found")));
+    const std::hash<xt::result<int, xt::code>> hasher{ };
+    EXPECT_EQ(hasher(open_file(false)), hasher(open_file(false)));
+}
+
+TEST(code, CollidingInternProbesOutsideCompileTimeIds)
+{
+    //"m17989" and "m898386" share a hash id in category "collision".
+    constexpr auto home = xt::detail::hash_code("collision", "m17989");
+    static_assert(home == xt::detail::hash_code("collision", "m898386"));
+    static_assert((home & xt::detail::probed_code_bit) == 0);
+
+    const auto first = xt::code::intern("collision", "m17989");
+    const auto second = xt::code::intern("collision", "m898386");
+    EXPECT_EQ(first.id(), home);
+    EXPECT_NE(second, first);
+    EXPECT_NE(second.id() & xt::detail::probed_code_bit, 0u);
+    EXPECT_EQ(second.message(), "m898386");
+    EXPECT_EQ(xt::code::intern("collision", "m898386"), second);
+}
+
+TEST(code, StaticCollisionFailsInEveryBuildMode)
+{
+    auto& registry = xt::code_registry::instance();
+    const auto taken = xt::detail::hash_code("collision", "m17989");
+    static_cast<void>(xt::code::intern("collision", "m17989"));
+
+    EXPECT_EQ(registry.add_static(taken, "collision", "m17989").id(), taken);
+    EXPECT_THROW(static_cast<void>(registry.add_static(taken, "collision", "m898386")), std::logic_error);
+    EXPECT_EQ(xt::code{ taken }.message(), "m17989");
+}
@@ -191,4 +191,61 @@ TEST(error, DereferenceConstRValue)
     xt::error<std::string> error(value);
     const std::string moved = *std::move(error);
     EXPECT_EQ(moved, value);
-}
\ No newline at end of file
+}
+
+TEST(error, Equality)
+{
+    const xt::error<std::string> error{ "error" };
+    EXPECT_EQ(error, xt::error<std::string>{ "error" });
+    EXPECT_NE(error, xt::error<std::string>{ "other" });
+    EXPECT_NE(error, xt::error<std::string>{ });
+    EXPECT_EQ(xt::error<std::string>{ }, xt::error<std::string>{ });
+}
+
+TEST(error, ThreeWayComparison)
+{
+    const xt::error<int> empty{ };
+    const xt::error<int> small{ 1 };
+    const xt::error<int> large{ 2 };
+    EXPECT_LT(empty, small);
+    EXPECT_LT(small, large);
+    EXPECT_EQ(large <=> xt::error<int>{ 2 }, std::strong_ordering::equal);
+}
+
+TEST(error, HashDistinguishesEmptyError)
+{
+    const std::hash<xt::error<std::string>> hasher{ };
+    EXPECT_EQ(hasher(xt::error<std::string>{ "error" }), hasher(xt::error<std::string>{ "error" }));
+    EXPECT_NE(hasher(xt::error<std::string>{ }), hasher(xt::error<std::string>{ "" }));
+}
+
+namespace
+{
+    struct construction_counted
+    {
+        static inline int default_constructions = 0;
+        static inline int assignments = 0;
+
+        construction_counted() { ++default_constructions; }
+        construction_counted(int v) : value(v) { }
+        construction_counted(const construction_counted&) = default;
+        construction_counted& operator=(const construction_counted& other) { ++assignments; value = other.value; return *this; }
+
+        int value = 0;
+    };
+}
+
+TEST(error, ConvertingConstructorConstructsInPlace)
+{
+    construction_counted::default_constructions = 0;
+    construction_counted::assignments = 0;
+
+    const xt::error<int> source{ 7 };
+    const xt::error<construction_counted> copied{ source };
+    const xt::error<construction_counted> moved{ xt::error<int>{ 8 } };
+
+    EXPECT_EQ(copied->value, 7);
+    EXPECT_EQ(moved->value, 8);
+    EXPECT_EQ(construction_counted::default_constructions, 0);
+    EXPECT_EQ(construction_counted::assignments, 0);
+}
@@ -0,0 +1,91 @@
+#include <result/format.hpp>
+#include <string>
+#include <gtest/gtest.h>
+
+TEST(format, ResultValue)
+{
+    const xt::result<int, std::string> result{ 42 };
+    EXPECT_EQ(std::format("{}", result), "42");
+}
+
+TEST(format, ResultError)
+{
+    const xt::result<int, std::string> result{ xt::error<std::string>{ "failure" } };
+    EXPECT_EQ(std::format("{}", result), "failure");
+}
+
+TEST(format, ResultValueOnly)
+{
+    const xt::result<int, std::string> value{ 42 };
+    const xt::result<int, std::string> error{ xt::error<std::string>{ "failure" } };
+    EXPECT_EQ(std::format("{:v}", value), "42");
+    EXPECT_EQ(std::format("{:v}", error), "");
+}
+
+TEST(format, ResultErrorOnly)
+{
+    const xt::result<int, std::string> value{ 42 };
+    const xt::result<int, std::string> error{ xt::error<std::string>{ "failure" } };
+    EXPECT_EQ(std::format("{:e}", value), "");
+    EXPECT_EQ(std::format("{:e}", error), "failure");
+}
+
+TEST(format, ResultNestedSpecification)
+{
+    const xt::result<int, std::string> value{ 42 };
+    const xt::result<int, std::string> error{ xt::error<std::string>{ "failure" } };
+    EXPECT_EQ(std::format("{:v:>5}", value), "   42");
+    EXPECT_EQ(std::format("{:e:*<9}", error), "failure**");
+}
+
+TEST(format, ResultNestedDynamicWidth)
+{
+    const xt::result<int, std::string> value{ 42 };
+    const xt::result<int, std::string> error{ xt::error<std::string>{ "failure" } };
+    EXPECT_EQ(std::format("{:v:>{}}", value, 5), "   42");
+    EXPECT_EQ(std::format("{:e:*<{}}", error, 9), "failure**");
+}
+
+TEST(format, ResultRejectsSpecificationWithoutMode)
+{
+    const xt::result<int, std::string> value{ 42 };
+    EXPECT_THROW(static_cast<void>(std::vformat("{:>5}", std::make_format_args(value))), std::format_error);
+    EXPECT_THROW(static_cast<void>(std::vformat("{:?>5}", std::make_format_args(value))), std::format_error);
+}
+
+TEST(format, ResultDebug)
+{
+    const xt::result<int, int> value{ 42 };
+    const xt::result<int, int> error{ xt::error<int>{ 7 } };
+    EXPECT_EQ(std::format("{:?}", value), "ok(42)");
+    EXPECT_EQ(std::format("{:?}", error), "error(7)");
+}
+
+TEST(format, ErrorPayload)
+{
+    const xt::error<std::string> error{ "failure" };
+    EXPECT_EQ(std::format("{}", error), "failure");
+    EXPECT_EQ(std::format("{:>9}", error), "  failure");
+}
+
+TEST(format, EmptyError)
+{
+    const xt::error<int> error{ };
+    EXPECT_EQ(std::format("{}", error), "");
+    EXPECT_EQ(std::format("{:?}", error), "error()");
+}
+
+TEST(format, ErrorDebug)
+{
+    const xt::error<int> error{ 7 };
+    EXPECT_EQ(std::format("{:?}", error), "error(7)");
+}
+
+TEST(format, WritesIntoFixedBuffer)
+{
+    const xt::result<int, std::string> result{ 12345 };
+    char buffer[8]{ };
+    const auto out = std::format_to_n(buffer, sizeof(buffer), "{:?}", result);
+    EXPECT_EQ(out.size, 9);
+    EXPECT_EQ(std::string_view(buffer, sizeof(buffer)), "ok(12345");
+}
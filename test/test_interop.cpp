@@ -0,0 +1,189 @@
+#include <result/interop.hpp>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+namespace
+{
+    struct tracked
+    {
+        static inline int copies = 0;
+        static inline int moves = 0;
+
+        int id = 0;
+
+        tracked() = default;
+
+        tracked(int i) : id(i)
+        {
+        }
+
+        tracked(const tracked& other) : id(other.id)
+        {
+            ++copies;
+        }
+
+        tracked(tracked&& other) noexcept : id(other.id)
+        {
+            ++moves;
+        }
+
+        tracked& operator=(const tracked&) = default;
+        tracked& operator=(tracked&&) = default;
+
+        static void reset()
+        {
+            copies = 0;
+            moves = 0;
+        }
+    };
+
+    //Long enough to defeat the small string optimisation, so a moved string keeps its buffer.
+    const std::string long_text(64, 'x');
+}
+
+TEST(interop, FromExpectedValue)
+{
+    std::expected<std::string, std::string> expected{ long_text };
+    const char* buffer = expected->data();
+    const xt::result<std::string, std::string> result{ std::move(expected) };
+    EXPECT_TRUE(result.has_value());
+    EXPECT_EQ(*result, long_text);
+    EXPECT_EQ(result->data(), buffer);
+}
+
+TEST(interop, FromExpectedError)
+{
+    std::expected<int, std::string> expected{ std::unexpect, long_text };
+    const char* buffer = expected.error().data();
+    const xt::result<int, std::string> result{ std::move(expected) };
+    EXPECT_FALSE(result.has_value());
+    EXPECT_EQ(result.template get<1>()->data(), buffer);
+}
+
+TEST(interop, FromExpectedLValueCopies)
+{
+    const std::expected<int, std::string> expected{ std::unexpect, "failure" };
+    const xt::result<int, std::string> result{ expected };
+    EXPECT_FALSE(result.has_value());
+    EXPECT_EQ(result.get_error(), "failure");
+    EXPECT_EQ(expected.error(), "failure");
+}
+
+TEST(interop, FromExpectedMovesOnce)
+{
+    tracked::reset();
+    std::expected<tracked, tracked> expected{ std::in_place, 7 };
+    const xt::result<tracked, tracked> result{ std::move(expected) };
+    EXPECT_EQ(result->id, 7);
+    EXPECT_EQ(tracked::copies, 0);
+    EXPECT_EQ(tracked::moves, 1);
+}
+
+TEST(interop, ErrorFromUnexpected)
+{
+    std::unexpected<std::string> unexpected{ long_text };
+    const char* buffer = unexpected.error().data();
+    const xt::error<std::string> error{ std::move(unexpected) };
+    EXPECT_TRUE(static_cast<bool>(error));
+    EXPECT_EQ(error->data(), buffer);
+}
+
+TEST(interop, ResultFromUnexpected)
+{
+    const xt::result<int, std::string> result = std::unexpected<std::string>{ "failure" };
+    EXPECT_FALSE(result.has_value());
+    EXPECT_EQ(result.get_error(), "failure");
+}
+
+TEST(interop, ToExpectedMovesValue)
+{
+    xt::result<std::string, std::string> result{ long_text };
+    const char* buffer = result->data();
+    const auto expected = std::move(result).to_expected();
+    ASSERT_TRUE(expected.has_value());
+    EXPECT_EQ(expected->data(), buffer);
+}
+
+TEST(interop, ToExpectedMovesError)
+{
+    tracked::reset();
+    xt::result<int, tracked> result{ xt::error<tracked>{ std::in_place, 3 } };
+    tracked::reset();
+    const auto expected = std::move(result).to_expected();
+    ASSERT_FALSE(expected.has_value());
+    EXPECT_EQ(expected.error().id, 3);
+    EXPECT_EQ(tracked::copies, 0);
+}
+
+TEST(interop, ToExpectedFromLValueCopies)
+{
+    const xt::result<int, std::string> result{ xt::error<std::string>{ "failure" } };
+    const auto expected = result.to_expected();
+    ASSERT_FALSE(expected.has_value());
+    EXPECT_EQ(expected.error(), "failure");
+    EXPECT_EQ(result.get_error(), "failure");
+}
+
+TEST(interop, ToOptional)
+{
+    xt::result<std::string, std::string> value{ long_text };
+    const char* buffer = value->data();
+    const auto optional = std::move(value).to_optional();
+    ASSERT_TRUE(optional.has_value());
+    EXPECT_EQ(optional->data(), buffer);
+
+    const xt::result<int, std::string> error{ xt::error<std::string>{ "failure" } };
+    EXPECT_FALSE(error.to_optional().has_value());
+}
+
+TEST(interop, CopyConstructorPreservesConvertedError)
+{
+    const xt::result<const char*, const char*> orig_result{ xt::error<const char*>{ "failure" } };
+    const xt::result<std::string, std::string> converted{ orig_result };
+    EXPECT_FALSE(converted.has_value());
+    EXPECT_EQ(converted.get_error(), "failure");
+}
+
+TEST(interop, BulkToResultsMovesElements)
+{
+    std::vector<std::expected<tracked, tracked>> expecteds{ };
+    expecteds.reserve(3);
+    expecteds.emplace_back(std::in_place, 1);
+    expecteds.emplace_back(std::unexpect, 2);
+    expecteds.emplace_back(std::in_place, 3);
+
+    tracked::reset();
+    const auto results = xt::to_results(std::move(expecteds));
+    ASSERT_EQ(results.size(), 3u);
+    EXPECT_EQ(results[0]->id, 1);
+    EXPECT_FALSE(results[1].has_value());
+    EXPECT_EQ(results[1].template get<1>()->id, 2);
+    EXPECT_EQ(results[2]->id, 3);
+    EXPECT_EQ(tracked::copies, 0);
+    EXPECT_EQ(tracked::moves, 3);
+}
+
+TEST(interop, BulkToResultsCopiesLValue)
+{
+    const std::vector<std::expected<int, std::string>> expecteds{ 1, std::unexpected<std::string>{ "failure" } };
+    const auto results = xt::to_results(expecteds);
+    ASSERT_EQ(results.size(), 2u);
+    EXPECT_EQ(*results[0], 1);
+    EXPECT_EQ(results[1].get_error(), "failure");
+    EXPECT_EQ(expecteds[1].error(), "failure");
+}
+
+TEST(interop, BulkToExpectedMovesElements)
+{
+    std::vector<xt::result<std::string, std::string>> results{ };
+    results.emplace_back(long_text);
+    results.emplace_back(xt::error<std::string>{ long_text });
+    const char* value_buffer = results[0]->data();
+    const char* error_buffer = results[1].template get<1>()->data();
+
+    const auto expecteds = xt::to_expected(std::move(results));
+    ASSERT_EQ(expecteds.size(), 2u);
+    EXPECT_EQ(expecteds[0]->data(), value_buffer);
+    EXPECT_EQ(expecteds[1].error().data(), error_buffer);
+}
@@ -1,5 +1,6 @@
 #include <result/result.hpp>
 #include <string>
+#include <unordered_set>
 #include <gtest/gtest.h>
 TEST(result, DefaultConstructor)
 {
@@ -16,6 +17,14 @@ TEST(result, CopyConstructor)
     EXPECT_EQ(*copied_result, "hello");
 }
 
+TEST(result, CopyConstructorPreservesError)
+{
+    const xt::result<int, std::string> orig_result{ xt::error<std::string>{ "failure" } };
+    const xt::result<int, std::string> copied_result{ orig_result };
+    EXPECT_FALSE(copied_result.has_value());
+    EXPECT_EQ(copied_result.get_error(), "failure");
+}
+
 TEST(result, MoveConstructor)
 {
     xt::result<std::string, std::string> orig_result{ "hello" };
@@ -181,3 +190,69 @@ TEST(result, StructuredBinding)
     EXPECT_FALSE(error);
     EXPECT_EQ(value, 10);
 }
+
+TEST(result, EqualityComparesValues)
+{
+    const xt::result<int, std::string> lhs{ 10 };
+    EXPECT_EQ(lhs, (xt::result<int, std::string>{ 10 }));
+    EXPECT_NE(lhs, (xt::result<int, std::string>{ 11 }));
+}
+
+TEST(result, EqualityComparesErrors)
+{
+    const xt::result<int, std::string> lhs{ xt::error<std::string>{ "failure" } };
+    EXPECT_EQ(lhs, (xt::result<int, std::string>{ xt::error<std::string>{ "failure" } }));
+    EXPECT_NE(lhs, (xt::result<int, std::string>{ xt::error<std::string>{ "other" } }));
+    EXPECT_NE(lhs, (xt::result<int, std::string>{ 0 }));
+}
+
+TEST(result, ThreeWayComparison)
+{
+    const xt::result<int, std::string> small{ 1 };
+    const xt::result<int, std::string> large{ 2 };
+    const xt::result<int, std::string> failed{ xt::error<std::string>{ "a" } };
+    const xt::result<int, std::string> failed_later{ xt::error<std::string>{ "b" } };
+    EXPECT_LT(small, large);
+    EXPECT_LT(large, failed);
+    EXPECT_LT(failed, failed_later);
+    EXPECT_EQ(small <=> small, std::strong_ordering::equal);
+}
+
+TEST(result, EqualityAcrossSpecializations)
+{
+    const xt::result<int, std::string> lhs{ 1 };
+    const xt::result<int, std::string> failed{ xt::error<std::string>{ "failure" } };
+    EXPECT_TRUE(lhs == (xt::result<long, std::string>{ 1L }));
+    EXPECT_FALSE(lhs == (xt::result<long, std::string>{ 2L }));
+    EXPECT_TRUE(failed == (xt::result<long, std::string>{ xt::error<std::string>{ "failure" } }));
+    EXPECT_FALSE(failed == (xt::result<long, std::string>{ 1L }));
+}
+
+TEST(result, ThreeWayComparisonAcrossSpecializations)
+{
+    const xt::result<int, std::string> lhs{ 1 };
+    const xt::result<int, std::string> failed{ xt::error<std::string>{ "a" } };
+    EXPECT_EQ(lhs <=> (xt::result<long, std::string>{ 1L }), std::strong_ordering::equal);
+    EXPECT_EQ(lhs <=> (xt::result<long, std::string>{ 2L }), std::strong_ordering::less);
+    EXPECT_EQ(failed <=> (xt::result<long, std::string>{ 0L }), std::strong_ordering::greater);
+    EXPECT_EQ(failed <=> (xt::result<long, std::string>{ xt::error<std::string>{ "b" } }), std::strong_ordering::less);
+}
+
+TEST(result, HashDistinguishesValueAndError)
+{
+    const xt::result<int, int> value{ 5 };
+    const xt::result<int, int> error{ xt::error<int>{ 5 } };
+    const std::hash<xt::result<int, int>> hasher{ };
+    EXPECT_EQ(hasher(value), hasher(xt::result<int, int>{ 5 }));
+    EXPECT_NE(hasher(value), hasher(error));
+}
+
+TEST(result, UsableAsUnorderedKey)
+{
+    std::unordered_set<xt::result<int, std::string>> set{ };
+    set.insert(xt::result<int, std::string>{ 1 });
+    set.insert(xt::result<int, std::string>{ 1 });
+    set.insert(xt::result<int, std::string>{ xt::error<std::string>{ "failure" } });
+    set.insert(xt::result<int, std::string>{ xt::error<std::string>{ "failure" } });
+    EXPECT_EQ(set.size(), 2);
+}
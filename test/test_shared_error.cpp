@@ -0,0 +1,201 @@
+#include <result/shared_error.hpp>
+#include <string>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <stdexcept>
+#include <gtest/gtest.h>
+
+namespace
+{
+    struct lifetime_counted
+    {
+        static inline std::atomic<int> alive = 0;
+
+        explicit lifetime_counted(std::string text) : text(std::move(text)) { ++alive; }
+        lifetime_counted(const lifetime_counted& other) : text(other.text) { ++alive; }
+        ~lifetime_counted() { --alive; }
+
+        std::string text;
+    };
+
+    struct wrapped_error
+    {
+        wrapped_error() = default;
+        wrapped_error(xt::shared_error<std::string> inner) : inner(std::move(inner)) { }
+
+        xt::shared_error<std::string> inner;
+    };
+}
+
+TEST(shared_error, DefaultIsEmpty)
+{
+    const xt::shared_error<std::string> err{ };
+    EXPECT_FALSE(static_cast<bool>(err));
+    EXPECT_EQ(err.get(), nullptr);
+    EXPECT_EQ(err.use_count(), 0u);
+}
+
+TEST(shared_error, CopySharesPayload)
+{
+    const auto err = xt::make_shared_error<std::string>("connection reset");
+    const auto copy = err;
+    EXPECT_EQ(err.get(), copy.get());
+    EXPECT_EQ(err.use_count(), 2u);
+    EXPECT_EQ(*copy, "connection reset");
+}
+
+TEST(shared_error, MoveLeavesSourceEmpty)
+{
+    auto err = xt::make_shared_error<std::string>("timeout");
+    const std::string* payload = err.get();
+    const auto moved = std::move(err);
+    EXPECT_FALSE(static_cast<bool>(err));
+    EXPECT_EQ(moved.get(), payload);
+    EXPECT_EQ(moved.use_count(), 1u);
+}
+
+TEST(shared_error, PayloadIsImmutable)
+{
+    using err_type = xt::shared_error<std::string>;
+    static_assert(std::is_same_v<decltype(*std::declval<err_type&>()), const std::string&>);
+    static_assert(std::is_same_v<decltype(std::declval<err_type&>().operator->()), const std::string*>);
+}
+
+TEST(shared_error, DestroysPayloadWithLastReference)
+{
+    lifetime_counted::alive = 0;
+    {
+        const auto err = xt::make_shared_error<lifetime_counted>("io");
+        {
+            auto first = err;
+            auto second = first;
+            second = err;
+            second = second;
+            EXPECT_EQ(err.use_count(), 3u);
+        }
+        EXPECT_EQ(lifetime_counted::alive, 1);
+        EXPECT_EQ(err.use_count(), 1u);
+    }
+    EXPECT_EQ(lifetime_counted::alive, 0);
+}
+
+TEST(shared_error, AssignmentReleasesPrevious)
+{
+    lifetime_counted::alive = 0;
+    auto err = xt::make_shared_error<lifetime_counted>("first");
+    err = xt::make_shared_error<lifetime_counted>("second");
+    EXPECT_EQ(lifetime_counted::alive, 1);
+    EXPECT_EQ(err->text, "second");
+    err = xt::shared_error<lifetime_counted>{ };
+    EXPECT_EQ(lifetime_counted::alive, 0);
+}
+
+TEST(shared_error, LocalPolicy)
+{
+    lifetime_counted::alive = 0;
+    {
+        const auto err = xt::make_shared_error<lifetime_counted, xt::local_refcount>("local");
+        std::vector copies(10, err);
+        EXPECT_EQ(err.use_count(), 11u);
+    }
+    EXPECT_EQ(lifetime_counted::alive, 0);
+}
+
+TEST(shared_error, ErrorUsesEmptyState)
+{
+    using err_type = xt::shared_error<std::string>;
+    static_assert(sizeof(xt::error<err_type>) == sizeof(err_type));
+
+    const xt::error<err_type> empty{ };
+    const xt::error<err_type> engaged{ err_type{ "failed" } };
+    EXPECT_FALSE(static_cast<bool>(empty));
+    EXPECT_TRUE(static_cast<bool>(engaged));
+    EXPECT_EQ(**engaged, "failed");
+}
+
+TEST(shared_error, EngagedErrorRejectsEmptyHandle)
+{
+    using err_type = xt::shared_error<std::string>;
+    err_type payload{ "failed" };
+    const err_type moved = std::move(payload);
+
+    EXPECT_THROW(static_cast<void>(xt::error{ payload }), std::invalid_argument);
+    EXPECT_THROW(static_cast<void>(xt::error<err_type>{ err_type{ } }), std::invalid_argument);
+    EXPECT_THROW((xt::result<int, err_type>{ xt::error<err_type>{ std::move(payload) } }), std::invalid_argument);
+
+    const xt::result<int, err_type> failed{ xt::error{ moved } };
+    EXPECT_FALSE(failed.has_value());
+    EXPECT_EQ(*failed.get_error(), "failed");
+
+    //Moving the handle out empties the source, the converted error still counts as engaged.
+    const xt::error<wrapped_error> converted{ xt::error<err_type>{ moved } };
+    EXPECT_TRUE(static_cast<bool>(converted));
+    EXPECT_EQ(*converted->inner, "failed");
+}
+
+TEST(shared_error, ResultFanOutSharesPayload)
+{
+    const xt::result<int, xt::shared_error<std::string>> failed{ xt::error{ xt::make_shared_error<std::string>("unavailable") } };
+    std::vector fanned(100, failed);
+    const auto& [value, err] = failed;
+    const auto& [fanned_value, fanned_err] = fanned.back();
+    EXPECT_EQ(err->use_count(), 101u);
+    EXPECT_EQ(fanned_err->get(), err->get());
+}
+
+TEST(shared_error, Comparison)
+{
+    const auto a = xt::make_shared_error<std::string>("a");
+    const auto other_a = xt::make_shared_error<std::string>("a");
+    const auto b = xt::make_shared_error<std::string>("b");
+    const xt::shared_error<std::string> empty{ };
+
+    EXPECT_EQ(a, other_a);
+    EXPECT_NE(a, b);
+    EXPECT_NE(a, empty);
+    EXPECT_EQ(empty, xt::shared_error<std::string>{ });
+    EXPECT_LT(a, b);
+    EXPECT_LT(empty, a);
+    EXPECT_EQ(std::hash<xt::shared_error<std::string>>{ }(a), std::hash<xt::shared_error<std::string>>{ }(other_a));
+}
+
+TEST(shared_error, ConcurrentCopiesKeepCountConsistent)
+{
+    lifetime_counted::alive = 0;
+    {
+        const auto err = xt::make_shared_error<lifetime_counted>("shared between threads");
+        std::vector<std::thread> threads;
+        std::atomic<std::size_t> length_sum = 0;
+        for (int t = 0; t < 8; ++t)
+        {
+            threads.emplace_back([&err, &length_sum]
+            {
+                std::vector<xt::shared_error<lifetime_counted>> copies;
+                for (int i = 0; i < 10000; ++i)
+                {
+                    copies.push_back(err);
+                    if (copies.size() == 64)
+                        copies.clear();
+                }
+                length_sum += copies.empty() ? 0 : copies.front()->text.size();
+            });
+        }
+
+        for (auto& thread : threads)
+            thread.join();
+
+        EXPECT_EQ(err.use_count(), 1u);
+        EXPECT_EQ(lifetime_counted::alive, 1);
+        EXPECT_GT(length_sum.load(), 0u);
+    }
+    EXPECT_EQ(lifetime_counted::alive, 0);
+}
+
+TEST(shared_error, LastReferenceDroppedOnAnotherThread)
+{
+    lifetime_counted::alive = 0;
+    auto err = xt::make_shared_error<lifetime_counted>("handed over");
+    std::thread([moved = std::move(err)] { EXPECT_EQ(moved->text, "handed over"); }).join();
+    EXPECT_EQ(lifetime_counted::alive, 0);
+}
@@ -0,0 +1,271 @@
+#include <result/slim_result.hpp>
+#include <latch>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+namespace
+{
+    xt::slim_result<int, std::string> parse(int input)
+    {
+        if (input < 0)
+            return xt::error<std::string>{ "negative: " + std::to_string(input) };
+
+        return input * 2;
+    }
+
+    xt::slim_result<int, std::string> parse_both(int lhs, int rhs)
+    {
+        auto first = parse(lhs);
+        if (!first)
+            return xt::error<std::string>{ "lhs " + std::move(first).take_error() };
+
+        auto second = parse(rhs);
+        if (!second)
+            return xt::error<std::string>{ "rhs " + std::move(second).take_error() };
+
+        return *first + *second;
+    }
+}
+
+TEST(slim_result, IsNoBiggerThanValueOrTicketAndFlag)
+{
+    static_assert(sizeof(xt::slim_result<int, std::string>) == 8);
+    static_assert(sizeof(xt::slim_result<std::uint64_t, std::string>) == 16);
+    static_assert(std::is_trivially_copyable_v<xt::slim_result<int, std::string>>);
+    static_assert(!std::is_trivially_copyable_v<xt::slim_result<std::string, std::string>>);
+    SUCCEED();
+}
+
+TEST(slim_result, HoldsValue)
+{
+    const auto result = parse(21);
+    EXPECT_TRUE(result.has_value());
+    EXPECT_EQ(*result, 42);
+}
+
+TEST(slim_result, ParksError)
+{
+    const auto result = parse(-1);
+    EXPECT_FALSE(result.has_value());
+    EXPECT_EQ(result.get_error(), "negative: -1");
+}
+
+TEST(slim_result, LvalueErrorIsParked)
+{
+    xt::error<std::string> err{ "boom" };
+    const xt::slim_result<int, std::string> result{ err };
+    EXPECT_FALSE(result.has_value());
+    EXPECT_EQ(result.get_error(), "boom");
+}
+
+TEST(slim_result, NonTrivialValue)
+{
+    xt::slim_result<std::string, int> result{ std::string(64, 'x') };
+    const auto copy = result;
+    const auto moved = std::move(result);
+    EXPECT_EQ(*copy, std::string(64, 'x'));
+    EXPECT_EQ(moved->size(), 64u);
+}
+
+TEST(slim_result, NonTrivialValueIsAssignable)
+{
+    static_assert(std::is_copy_assignable_v<xt::slim_result<std::string, int>>);
+    static_assert(std::is_move_assignable_v<xt::slim_result<std::string, int>>);
+
+    xt::slim_result<std::string, int> result{ std::string(64, 'x') };
+    const xt::slim_result<std::string, int> failed{ xt::error<int>{ 7 } };
+    result = failed;
+    EXPECT_FALSE(result.has_value());
+    EXPECT_EQ(result.get_error(), 7);
+
+    result = xt::slim_result<std::string, int>{ std::string(64, 'y') };
+    EXPECT_EQ(*result, std::string(64, 'y'));
+
+    const xt::slim_result<std::string, int> other{ std::string(64, 'z') };
+    result = other;
+    EXPECT_EQ(*result, std::string(64, 'z'));
+    EXPECT_EQ(*other, std::string(64, 'z'));
+}
+
+TEST(slim_result, ToResultMovesValue)
+{
+    xt::slim_result<std::string, int> slim{ std::string(64, 'x') };
+    const char* buffer = slim->data();
+    const auto full = std::move(slim).to_result();
+    EXPECT_TRUE(full.has_value());
+    EXPECT_EQ(full->data(), buffer);
+}
+
+TEST(slim_result, ToResultMovesParkedError)
+{
+    xt::slim_result<int, std::string> slim{ xt::error<std::string>{ std::string(64, 'e') } };
+    const char* buffer = slim.get_error().data();
+    const auto full = std::move(slim).to_result();
+    EXPECT_FALSE(full.has_value());
+    EXPECT_EQ(full.template get<1>()->data(), buffer);
+    EXPECT_EQ(full.get_error(), std::string(64, 'e'));
+}
+
+TEST(slim_result, TakeErrorFreesSlot)
+{
+    auto slim = parse(-5);
+    EXPECT_EQ(std::move(slim).take_error(), "negative: -5");
+
+    std::vector<xt::slim_result<int, std::string>> results{ };
+    for (int i = 0; i < static_cast<int>(xt::slim_error_capacity); ++i)
+        results.push_back(parse(-i - 1));
+
+    for (int i = 0; i < static_cast<int>(xt::slim_error_capacity); ++i)
+        EXPECT_EQ(std::move(results[i]).take_error(), "negative: " + std::to_string(-i - 1));
+}
+
+TEST(slim_result, LongLivedErrorSurvivesConsumedOnes)
+{
+    const auto outer = parse(-1);
+    for (int i = 0; i < 10 * static_cast<int>(xt::slim_error_capacity); ++i)
+        EXPECT_EQ(parse(-2).to_result().get_error(), "negative: -2");
+
+    EXPECT_EQ(outer.get_error(), "negative: -1");
+}
+
+TEST(slim_result, ToResultCopyKeepsErrorParked)
+{
+    const auto slim = parse(-4);
+    const auto full = slim.to_result();
+    EXPECT_EQ(full.get_error(), "negative: -4");
+    EXPECT_EQ(slim.get_error(), "negative: -4");
+}
+
+TEST(slim_result, NestedCallsKeepTheirOwnErrors)
+{
+    const auto outer = parse(-1);
+    const auto nested = parse_both(2, -5);
+    const auto inner_ok = parse_both(1, 2);
+
+    EXPECT_EQ(outer.get_error(), "negative: -1");
+    EXPECT_EQ(nested.get_error(), "rhs negative: -5");
+    EXPECT_EQ(*inner_ok, 6);
+}
+
+TEST(slim_result, ManyOutstandingErrors)
+{
+    std::vector<xt::slim_result<int, std::string>> results{ };
+    for (int i = 1; i <= static_cast<int>(xt::slim_error_capacity); ++i)
+        results.push_back(parse(-i));
+
+    for (int i = 1; i <= static_cast<int>(xt::slim_error_capacity); ++i)
+        EXPECT_EQ(results[i - 1].get_error(), "negative: -" + std::to_string(i));
+}
+
+TEST(slim_result, EvictsWhenAllSlotsAreTaken)
+{
+    //A fresh thread starts with every slot free.
+    std::jthread([]
+    {
+        std::vector<xt::slim_result<int, std::string>> results{ };
+        for (int i = 1; i <= static_cast<int>(xt::slim_error_capacity) + 1; ++i)
+            results.push_back(parse(-i));
+
+        EXPECT_THROW(static_cast<void>(results.front().get_error()), std::logic_error);
+        for (std::size_t i = 1; i < results.size(); ++i)
+            EXPECT_EQ(results[i].get_error(), "negative: -" + std::to_string(i + 1));
+    });
+}
+
+TEST(slim_result, DroppedFailuresAreReclaimed)
+{
+    std::jthread([]
+    {
+        for (int i = 0; i < 10 * static_cast<int>(xt::slim_error_capacity); ++i)
+            static_cast<void>(parse(-1));
+
+        std::vector<xt::slim_result<int, std::string>> results{ };
+        for (int i = 1; i <= static_cast<int>(xt::slim_error_capacity); ++i)
+            results.push_back(parse(-i));
+
+        for (int i = 1; i <= static_cast<int>(xt::slim_error_capacity); ++i)
+            EXPECT_EQ(results[i - 1].get_error(), "negative: -" + std::to_string(i));
+    });
+}
+
+TEST(slim_result, ErrorIsNotVisibleFromAnotherThread)
+{
+    const xt::slim_result<int, std::string> result{ xt::error<std::string>{ "from main" } };
+    std::jthread([&result]
+    {
+        const xt::slim_result<int, std::string> own{ xt::error<std::string>{ "from worker" } };
+        EXPECT_THROW(static_cast<void>(result.get_error()), std::logic_error);
+        EXPECT_EQ(own.get_error(), "from worker");
+    });
+    EXPECT_EQ(result.get_error(), "from main");
+}
+
+TEST(slim_result, NonTrivialValueCopiesTicket)
+{
+    const xt::slim_result<std::string, int> failed{ xt::error<int>{ 7 } };
+    const auto copy = failed;
+    auto moved = xt::slim_result<std::string, int>(copy);
+    EXPECT_EQ(copy.get_error(), 7);
+    EXPECT_EQ(std::move(moved).take_error(), 7);
+}
+
+TEST(slim_result, StaleTicketDoesNotSeeLaterError)
+{
+    auto failed = parse(-1);
+    const auto stale = failed;
+    EXPECT_EQ(std::move(failed).take_error(), "negative: -1");
+
+    const auto reused = parse(-2);
+    EXPECT_EQ(reused.get_error(), "negative: -2");
+    EXPECT_THROW(static_cast<void>(stale.get_error()), std::logic_error);
+}
+
+TEST(slim_result, ValueHasNoError)
+{
+    const auto result = parse(1);
+    EXPECT_THROW(static_cast<void>(result.get_error()), std::logic_error);
+}
+
+TEST(slim_result, ConsumedSlotsAreReused)
+{
+    for (int i = 0; i < 10 * static_cast<int>(xt::slim_error_capacity); ++i)
+    {
+        const auto outer = parse(-1);
+        auto inner = parse(-i - 2);
+        EXPECT_EQ(std::move(inner).to_result().get_error(), "negative: " + std::to_string(-i - 2));
+        EXPECT_EQ(outer.get_error(), "negative: -1");
+    }
+}
+
+TEST(slim_result, ThreadIsolation)
+{
+    constexpr int thread_count = 8;
+    std::latch parked{ thread_count };
+    std::vector<int> mismatches(thread_count, 0);
+
+    std::vector<std::jthread> threads{ };
+    for (int t = 0; t < thread_count; ++t)
+    {
+        threads.emplace_back([&, t]
+        {
+            const auto result = parse(-(t + 1));
+            parked.arrive_and_wait();
+            for (int i = 0; i < 1000; ++i)
+            {
+                const auto noise = parse(-(i + 100));
+                if (result.get_error() != "negative: " + std::to_string(-(t + 1)))
+                    ++mismatches[t];
+                if (noise.get_error() != "negative: " + std::to_string(-(i + 100)))
+                    ++mismatches[t];
+                static_cast<void>(xt::slim_result<int, std::string>(noise).to_result());
+            }
+        });
+    }
+    threads.clear();
+
+    for (const int count : mismatches)
+        EXPECT_EQ(count, 0);
+}
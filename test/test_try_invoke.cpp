@@ -0,0 +1,145 @@
+#include <result/exception.hpp>
+#include <stdexcept>
+#include <string>
+#include <gtest/gtest.h>
+
+namespace
+{
+    int parse_positive(int value)
+    {
+        if (value < 0)
+            throw std::invalid_argument("negative input");
+
+        return value * 2;
+    }
+
+    int double_it(int value) noexcept
+    {
+        return value * 2;
+    }
+
+    enum class error_kind
+    {
+        invalid_argument,
+        other
+    };
+
+    error_kind map_exception()
+    {
+        try
+        {
+            throw;
+        }
+        catch (const std::invalid_argument&)
+        {
+            return error_kind::invalid_argument;
+        }
+        catch (...)
+        {
+            return error_kind::other;
+        }
+    }
+}
+
+TEST(try_invoke, ReturnsValue)
+{
+    const auto result = xt::try_invoke<std::string>(parse_positive, 21);
+    EXPECT_TRUE(result.has_value());
+    EXPECT_EQ(*result, 42);
+}
+
+TEST(try_invoke, MapsExceptionToMessage)
+{
+    const auto result = xt::try_invoke<std::string>(parse_positive, -1);
+    EXPECT_FALSE(result.has_value());
+    EXPECT_EQ(result.get_error(), "negative input");
+}
+
+TEST(try_invoke, MapsUnknownException)
+{
+    const auto result = xt::try_invoke<std::string>([] { throw 5; return 0; });
+    EXPECT_EQ(result.get_error(), "unknown exception");
+}
+
+TEST(try_invoke, CapturesExceptionPtr)
+{
+    const auto result = xt::try_invoke<std::exception_ptr>(parse_positive, -1);
+    ASSERT_FALSE(result.has_value());
+    EXPECT_THROW(std::rethrow_exception(result.get_error()), std::invalid_argument);
+}
+
+TEST(try_invoke, CustomMapper)
+{
+    const auto invalid = xt::try_invoke_with(map_exception, parse_positive, -1);
+    const auto other = xt::try_invoke_with(map_exception, [] { throw std::runtime_error("boom"); return 0; });
+    EXPECT_EQ(invalid.get_error(), error_kind::invalid_argument);
+    EXPECT_EQ(other.get_error(), error_kind::other);
+}
+
+TEST(try_invoke, VoidCallable)
+{
+    int calls = 0;
+    const auto result = xt::try_invoke<std::string>([&calls] { ++calls; });
+    static_assert(std::is_same_v<std::remove_cvref_t<decltype(*result)>, std::monostate>);
+    EXPECT_TRUE(result.has_value());
+    EXPECT_EQ(calls, 1);
+}
+
+TEST(try_invoke, NoexceptFastPath)
+{
+    const auto result = xt::try_invoke<std::string>(double_it, 4);
+    EXPECT_EQ(*result, 8);
+}
+
+TEST(try_invoke, ReferenceReturningCallableYieldsCopy)
+{
+    int stored = 3;
+    auto result = xt::try_invoke<std::string>([&stored]() -> int& { return stored; });
+    static_assert(std::is_same_v<decltype(result), xt::result<int, std::string>>);
+    stored = 4;
+    EXPECT_EQ(*result, 3);
+}
+
+TEST(value_or_throw, ReturnsValue)
+{
+    xt::result<std::string, std::string> result{ "value" };
+    EXPECT_EQ(result.value_or_throw(), "value");
+    EXPECT_EQ(std::move(result).value_or_throw(), "value");
+}
+
+TEST(value_or_throw, ThrowsBadResultAccess)
+{
+    const xt::result<int, std::string> result{ xt::error<std::string>{ "failure" } };
+    try
+    {
+        static_cast<void>(result.value_or_throw());
+        FAIL();
+    }
+    catch (const xt::bad_result_access<std::string>& e)
+    {
+        EXPECT_EQ(e.error(), "failure");
+    }
+}
+
+TEST(value_or_throw, ThrowsMappedException)
+{
+    const xt::result<int, std::string> result{ xt::error<std::string>{ "failure" } };
+    EXPECT_THROW(static_cast<void>(result.value_or_throw([](const std::string& e) { return std::runtime_error(e); })), std::runtime_error);
+}
+
+TEST(value_or_throw, MappedLvalueReturnsMutableValue)
+{
+    xt::result<std::string, std::string> result{ "value" };
+    std::string& value = result.value_or_throw([](const std::string& e) { return std::runtime_error(e); });
+    value = "changed";
+    EXPECT_EQ(*result, "changed");
+
+    xt::result<int, std::string> failed{ xt::error<std::string>{ "failure" } };
+    EXPECT_THROW(static_cast<void>(failed.value_or_throw([](const std::string& e) { return std::runtime_error(e); })), std::runtime_error);
+}
+
+TEST(value_or_throw, RoundTrip)
+{
+    const auto result = xt::try_invoke<std::string>([] { return xt::result<int, std::string>{ xt::error<std::string>{ "inner" } }.value_or_throw(); });
+    EXPECT_EQ(result.get_error(), "xt::result accessed without a value");
+}
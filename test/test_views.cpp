@@ -0,0 +1,167 @@
+#include <result/views.hpp>
+#include <span>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+namespace
+{
+    std::vector<xt::result<int, std::string>> make_results()
+    {
+        std::vector<xt::result<int, std::string>> results{ };
+        results.emplace_back(1);
+        results.emplace_back(xt::error<std::string>{ "first" });
+        results.emplace_back(2);
+        results.emplace_back(xt::error<std::string>{ "second" });
+        results.emplace_back(3);
+        return results;
+    }
+
+    xt::result<int, std::string> make_result(int i)
+    {
+        if (i % 2 == 0)
+            return xt::error<std::string>{ "even" };
+
+        return i;
+    }
+}
+
+TEST(views, Values)
+{
+    const auto results = make_results();
+    std::vector<int> values{ };
+    for (const int& value : results | xt::views::values)
+        values.push_back(value);
+
+    EXPECT_EQ(values, (std::vector<int>{ 1, 2, 3 }));
+}
+
+TEST(views, ValuesYieldReferences)
+{
+    auto results = make_results();
+    auto values = results | xt::views::values;
+    static_assert(std::is_same_v<std::ranges::range_reference_t<decltype(values)>, int&>);
+
+    EXPECT_EQ(&*values.begin(), &*results[0]);
+    for (int& value : values)
+        value *= 10;
+
+    EXPECT_EQ(*results[4], 30);
+}
+
+TEST(views, Errors)
+{
+    const auto results = make_results();
+    auto errors = results | xt::views::errors;
+    static_assert(std::is_same_v<std::ranges::range_reference_t<decltype(errors)>, const std::string&>);
+
+    std::vector<std::string> collected{ };
+    for (const std::string& error : errors)
+        collected.push_back(error);
+
+    EXPECT_EQ(collected, (std::vector<std::string>{ "first", "second" }));
+    EXPECT_EQ(&*errors.begin(), &*results[1].template get<1>());
+}
+
+TEST(views, ValuesIsBidirectional)
+{
+    auto results = make_results();
+    auto values = xt::views::values(std::span{ results });
+    static_assert(std::ranges::bidirectional_range<decltype(values)>);
+    static_assert(std::ranges::common_range<decltype(values)>);
+    static_assert(!std::ranges::borrowed_range<decltype(values)>);
+
+    auto last = std::ranges::prev(values.end());
+    EXPECT_EQ(*last, 3);
+    EXPECT_EQ(*std::ranges::prev(last), 2);
+}
+
+TEST(views, ValuesCachesBegin)
+{
+    std::vector<xt::result<int, std::string>> results(100, xt::result<int, std::string>{ xt::error<std::string>{ "failure" } });
+    results.emplace_back(7);
+
+    int inspected = 0;
+    auto values = results
+        | std::views::transform([&inspected](const xt::result<int, std::string>& result) -> const xt::result<int, std::string>& { ++inspected; return result; })
+        | xt::views::values;
+
+    EXPECT_EQ(*values.begin(), 7);
+    const int first_scan = inspected;
+    EXPECT_FALSE(values.empty());
+    EXPECT_EQ(values.front(), 7);
+    static_cast<void>(values.begin());
+    EXPECT_EQ(inspected - first_scan, 1);
+
+    //A copy starts with an empty cache and scans the leading errors again.
+    const int before_copy = inspected;
+    auto copy = values;
+    static_cast<void>(copy.begin());
+    EXPECT_EQ(inspected - before_copy, static_cast<int>(results.size()));
+}
+
+TEST(views, ValuesOfPrvalueResults)
+{
+    auto values = std::views::iota(1, 6) | std::views::transform(make_result) | xt::views::values;
+    static_assert(std::is_same_v<std::ranges::range_reference_t<decltype(values)>, int>);
+
+    std::vector<int> collected{ };
+    for (const int value : values)
+        collected.push_back(value);
+
+    EXPECT_EQ(collected, (std::vector<int>{ 1, 3, 5 }));
+}
+
+TEST(views, TakeUntilError)
+{
+    const auto results = make_results();
+    std::vector<int> values{ };
+    for (const auto& result : results | xt::views::take_until_error)
+        values.push_back(*result);
+
+    EXPECT_EQ(values, (std::vector<int>{ 1 }));
+}
+
+TEST(views, TakeUntilErrorWithoutErrors)
+{
+    const std::vector<xt::result<int, std::string>> results{ 1, 2, 3 };
+    EXPECT_EQ(std::ranges::distance(results | xt::views::take_until_error), 3);
+}
+
+TEST(views, TakeUntilErrorKeepsContiguity)
+{
+    auto results = make_results();
+    auto taken = results | xt::views::take_until_error;
+    static_assert(std::ranges::contiguous_range<decltype(taken)>);
+    static_assert(std::ranges::borrowed_range<decltype(xt::views::take_until_error(std::span{ results }))>);
+    EXPECT_EQ(&*taken.begin(), results.data());
+}
+
+TEST(views, TransformOk)
+{
+    const auto results = make_results();
+    auto transformed = results | xt::views::transform_ok([](const int value) { return std::to_string(value * 2); });
+    static_assert(std::ranges::sized_range<decltype(transformed)>);
+    static_assert(std::ranges::random_access_range<decltype(transformed)>);
+    ASSERT_EQ(transformed.size(), 5u);
+
+    EXPECT_EQ(*transformed[0], "2");
+    EXPECT_FALSE(transformed[1].has_value());
+    EXPECT_EQ(transformed[1].get_error(), "first");
+    EXPECT_EQ(*transformed[4], "6");
+}
+
+TEST(views, Composes)
+{
+    const auto results = make_results();
+    auto doubled = results
+        | xt::views::transform_ok([](const int value) { return value * 2; })
+        | xt::views::values
+        | std::views::take(2);
+
+    std::vector<int> collected{ };
+    for (const int value : doubled)
+        collected.push_back(value);
+
+    EXPECT_EQ(collected, (std::vector<int>{ 2, 4 }));
+}